@@ -45,7 +45,7 @@ function main ()
   esac
 
   # compile the translator
-  attempt gcc -std=c99 *.c $SRC/*.c $LEX -o zed
+  attempt gcc -std=c99 -pthread *.c $SRC/*.c $LEX -lm -o zed
 
   # clean up files
   rm lex.yy.c parser.tab.c parser.tab.h
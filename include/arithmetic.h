@@ -0,0 +1,294 @@
+/*****************************************************************************
+*                   Copyright (c) 2020-2021 Jack C. Lloyd.                   *
+*                            All rights reserved.                            *
+*****************************************************************************/
+
+#ifndef __ARITHMETIC__
+#define __ARITHMETIC__ 20261018 /**< Format: YYYY-MM-DD. */
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+/*****************************************************************************
+*                              Standard Library                              *
+*****************************************************************************/
+
+#include <stdlib.h>
+
+#include "context.h"
+
+/*****************************************************************************
+*                                  Builtins                                  *
+*****************************************************************************/
+
+/*
+ * The operations below are defined in this header, rather than in a source
+ * file, so that each is inlined into its caller: with GCC (5 and later) or
+ * Clang, each compiles to the arithmetic instruction followed by a single
+ * branch on the overflow (or carry) flag, taken only on overflow.
+ */
+
+#if defined (__has_builtin)
+#if __has_builtin (__builtin_add_overflow)
+#define ARITHMETIC_BUILTIN (1)
+#endif /* __builtin_add_overflow */
+#elif defined (__GNUC__) && __GNUC__ >= 5
+#define ARITHMETIC_BUILTIN (1)
+#endif /* __has_builtin */
+
+#if defined (__GNUC__)
+#define ARITHMETIC_UNLIKELY(x) (__builtin_expect (!!(x), 0))
+#else
+#define ARITHMETIC_UNLIKELY(x) (x)
+#endif /* __GNUC__ */
+
+/*****************************************************************************
+*                                  Naturals                                  *
+*****************************************************************************/
+
+/**
+ * Add two naturals.
+ *
+ * @param x The augend.
+ * @param y The addend.
+ * @param z A pointer to the sum.
+ * @return  Zero on success, otherwise EXIT_OVERFLOW.
+ */
+static inline int
+natadd (natural_t x, natural_t y, natural_t *z)
+{
+#ifdef ARITHMETIC_BUILTIN
+  return (ARITHMETIC_UNLIKELY (__builtin_add_overflow (x, y, z))
+          ? EXIT_OVERFLOW : EXIT_SUCCESS);
+#else
+  *z = x + y;
+
+  return (ARITHMETIC_UNLIKELY (*z < x) ? EXIT_OVERFLOW : EXIT_SUCCESS);
+#endif /* ARITHMETIC_BUILTIN */
+}
+
+/**
+ * Subtract two naturals.
+ *
+ * @param x The minuend.
+ * @param y The subtrahend.
+ * @param z A pointer to the difference.
+ * @return  Zero on success, otherwise EXIT_OVERFLOW.
+ */
+static inline int
+natsub (natural_t x, natural_t y, natural_t *z)
+{
+#ifdef ARITHMETIC_BUILTIN
+  return (ARITHMETIC_UNLIKELY (__builtin_sub_overflow (x, y, z))
+          ? EXIT_OVERFLOW : EXIT_SUCCESS);
+#else
+  *z = x - y;
+
+  return (ARITHMETIC_UNLIKELY (y > x) ? EXIT_OVERFLOW : EXIT_SUCCESS);
+#endif /* ARITHMETIC_BUILTIN */
+}
+
+/**
+ * Multiply two naturals.
+ *
+ * @param x The multiplicand.
+ * @param y The multiplier.
+ * @param z A pointer to the product.
+ * @return  Zero on success, otherwise EXIT_OVERFLOW.
+ */
+static inline int
+natmul (natural_t x, natural_t y, natural_t *z)
+{
+#ifdef ARITHMETIC_BUILTIN
+  return (ARITHMETIC_UNLIKELY (__builtin_mul_overflow (x, y, z))
+          ? EXIT_OVERFLOW : EXIT_SUCCESS);
+#else
+  *z = x * y;
+
+  return (ARITHMETIC_UNLIKELY (x != 0 && *z / x != y)
+          ? EXIT_OVERFLOW : EXIT_SUCCESS);
+#endif /* ARITHMETIC_BUILTIN */
+}
+
+/**
+ * Divide two naturals.
+ *
+ * @param x The dividend.
+ * @param y The divisor.
+ * @param z A pointer to the quotient.
+ * @return  Zero on success, otherwise EXIT_UNDEFINED.
+ */
+static inline int
+natdiv (natural_t x, natural_t y, natural_t *z)
+{
+  if (ARITHMETIC_UNLIKELY (y == 0))
+    {
+      return (EXIT_UNDEFINED);
+    }
+
+  *z = x / y;
+
+  return (EXIT_SUCCESS);
+}
+
+/**
+ * The remainder of two naturals.
+ *
+ * @param x The dividend.
+ * @param y The divisor.
+ * @param z A pointer to the remainder.
+ * @return  Zero on success, otherwise EXIT_UNDEFINED.
+ */
+static inline int
+natmod (natural_t x, natural_t y, natural_t *z)
+{
+  if (ARITHMETIC_UNLIKELY (y == 0))
+    {
+      return (EXIT_UNDEFINED);
+    }
+
+  *z = x % y;
+
+  return (EXIT_SUCCESS);
+}
+
+/*****************************************************************************
+*                                  Integers                                  *
+*****************************************************************************/
+
+/**
+ * Add two integers.
+ *
+ * @param x The augend.
+ * @param y The addend.
+ * @param z A pointer to the sum.
+ * @return  Zero on success, otherwise EXIT_OVERFLOW.
+ */
+static inline int
+intadd (integer_t x, integer_t y, integer_t *z)
+{
+#ifdef ARITHMETIC_BUILTIN
+  return (ARITHMETIC_UNLIKELY (__builtin_add_overflow (x, y, z))
+          ? EXIT_OVERFLOW : EXIT_SUCCESS);
+#else
+  if (ARITHMETIC_UNLIKELY (y > 0 ? x > INTEGER_MAX - y : x < INTEGER_MIN - y))
+    {
+      return (EXIT_OVERFLOW);
+    }
+
+  *z = x + y;
+
+  return (EXIT_SUCCESS);
+#endif /* ARITHMETIC_BUILTIN */
+}
+
+/**
+ * Subtract two integers.
+ *
+ * @param x The minuend.
+ * @param y The subtrahend.
+ * @param z A pointer to the difference.
+ * @return  Zero on success, otherwise EXIT_OVERFLOW.
+ */
+static inline int
+intsub (integer_t x, integer_t y, integer_t *z)
+{
+#ifdef ARITHMETIC_BUILTIN
+  return (ARITHMETIC_UNLIKELY (__builtin_sub_overflow (x, y, z))
+          ? EXIT_OVERFLOW : EXIT_SUCCESS);
+#else
+  if (ARITHMETIC_UNLIKELY (y < 0 ? x > INTEGER_MAX + y : x < INTEGER_MIN + y))
+    {
+      return (EXIT_OVERFLOW);
+    }
+
+  *z = x - y;
+
+  return (EXIT_SUCCESS);
+#endif /* ARITHMETIC_BUILTIN */
+}
+
+/**
+ * Multiply two integers.
+ *
+ * @param x The multiplicand.
+ * @param y The multiplier.
+ * @param z A pointer to the product.
+ * @return  Zero on success, otherwise EXIT_OVERFLOW.
+ */
+static inline int
+intmul (integer_t x, integer_t y, integer_t *z)
+{
+#ifdef ARITHMETIC_BUILTIN
+  return (ARITHMETIC_UNLIKELY (__builtin_mul_overflow (x, y, z))
+          ? EXIT_OVERFLOW : EXIT_SUCCESS);
+#else
+  long long const product = (long long) x * (long long) y;
+
+  if (ARITHMETIC_UNLIKELY (product < INTEGER_MIN || product > INTEGER_MAX))
+    {
+      return (EXIT_OVERFLOW);
+    }
+
+  *z = (integer_t) product;
+
+  return (EXIT_SUCCESS);
+#endif /* ARITHMETIC_BUILTIN */
+}
+
+/**
+ * Divide two integers, truncating towards zero.
+ *
+ * @param x The dividend.
+ * @param y The divisor.
+ * @param z A pointer to the quotient.
+ * @return  Zero on success, otherwise EXIT_UNDEFINED or EXIT_OVERFLOW.
+ */
+static inline int
+intdiv (integer_t x, integer_t y, integer_t *z)
+{
+  if (ARITHMETIC_UNLIKELY (y == 0))
+    {
+      return (EXIT_UNDEFINED);
+    }
+
+  if (ARITHMETIC_UNLIKELY (x == INTEGER_MIN && y == -1))
+    {
+      return (EXIT_OVERFLOW);
+    }
+
+  *z = x / y;
+
+  return (EXIT_SUCCESS);
+}
+
+/**
+ * The remainder of two integers, with the sign of the dividend.
+ *
+ * @param x The dividend.
+ * @param y The divisor.
+ * @param z A pointer to the remainder.
+ * @return  Zero on success, otherwise EXIT_UNDEFINED.
+ */
+static inline int
+intmod (integer_t x, integer_t y, integer_t *z)
+{
+  if (ARITHMETIC_UNLIKELY (y == 0))
+    {
+      return (EXIT_UNDEFINED);
+    }
+
+  *z = (y == -1) ? 0 : x % y;
+
+  return (EXIT_SUCCESS);
+}
+
+/****************************************************************************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif /* __cplusplus */
+
+#endif /* !__ARITHMETIC__ */
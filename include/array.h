@@ -0,0 +1,123 @@
+/*****************************************************************************
+*                   Copyright (c) 2020-2021 Jack C. Lloyd.                   *
+*                            All rights reserved.                            *
+*****************************************************************************/
+
+#ifndef __ARRAY__
+#define __ARRAY__ 20261018 /**< Format: YYYY-MM-DD. */
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+/*****************************************************************************
+*                              Standard Library                              *
+*****************************************************************************/
+
+#include <stddef.h>
+
+/*****************************************************************************
+*                                   Arrays                                   *
+*****************************************************************************/
+
+struct array;
+
+/**
+ * Allocate an array, every element of which is zeroed.
+ *
+ * @param length The number of elements.
+ * @param size   The size of each element, in bytes.
+ * @return       An initialised array on success, otherwise a null-pointer.
+ * @see          arrstring() and arrfree().
+ */
+struct array *
+arralloc (size_t length, size_t size);
+
+/**
+ * Allocate an array of characters, holding a copy of a string, whose data
+ * remains null-terminated.
+ *
+ * @param string The string to copy.
+ * @return       An initialised array on success, otherwise a null-pointer.
+ * @see          arralloc() and arrfree().
+ */
+struct array *
+arrstring (char const *string);
+
+/**
+ * Free an array, releasing its data once no other copy shares it.
+ *
+ * @param array The array to free.
+ * @see         arralloc() and arrstring().
+ */
+void
+arrfree (struct array *array);
+
+/*****************************************************************************
+*                               Copy and Move                                *
+*****************************************************************************/
+
+/**
+ * Copy an array, sharing its data until either copy is written to.
+ *
+ * @param array The array to copy.
+ * @return      The copy, to be freed independently of the original.
+ * @see         arrmove() and arrwrite().
+ */
+struct array *
+arrcopy (struct array *array);
+
+/**
+ * Move an array, transferring ownership without touching its reference
+ * count; for an argument whose last use is the call it is passed to.
+ *
+ * @param array A pointer to the array to move, set to a null-pointer.
+ * @return      The moved array.
+ * @see         arrcopy().
+ */
+struct array *
+arrmove (struct array **array);
+
+/*****************************************************************************
+*                               Read and Write                               *
+*****************************************************************************/
+
+/**
+ * The length of an array.
+ *
+ * @param array The array to measure.
+ * @return      The number of elements in said array.
+ * @see         arrread() and arrwrite().
+ */
+size_t
+arrlength (struct array const *array);
+
+/**
+ * Read from an array.
+ *
+ * @param array The array to read from.
+ * @return      A pointer to the (shared) elements of said array.
+ * @see         arrlength() and arrwrite().
+ */
+void const *
+arrread (struct array const *array);
+
+/**
+ * Write to an array, first copying its data if another copy shares it.
+ *
+ * @param array A pointer to the array to write to, which may be replaced.
+ * @return      A pointer to the (unshared) elements on success, otherwise a
+ *              null-pointer.
+ * @see         arrlength() and arrread().
+ */
+void *
+arrwrite (struct array **array);
+
+/****************************************************************************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif /* __cplusplus */
+
+#endif /* !__ARRAY__ */
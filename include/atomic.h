@@ -0,0 +1,196 @@
+/*****************************************************************************
+*                   Copyright (c) 2020-2021 Jack C. Lloyd.                   *
+*                            All rights reserved.                            *
+*****************************************************************************/
+
+#ifndef __ATOMIC__
+#define __ATOMIC__ 20261018 /**< Format: YYYY-MM-DD. */
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+/*****************************************************************************
+*                              Standard Library                              *
+*****************************************************************************/
+
+#include "context.h"
+
+/*****************************************************************************
+*                                  Builtins                                  *
+*****************************************************************************/
+
+/*
+ * The atomics below are those of the type system, e.g. "atomic natural64",
+ * named as atmnatural64_t. Each is read and written as a whole, by a single
+ * instruction (on x86-64, a plain move, or one with a lock prefix), with the
+ * __atomic builtins of GCC (4.7 and later) or Clang; C99 offers no atomics.
+ *
+ * The memory model is that of C11 and C++11. An operation orders the plain
+ * reads and writes around it as follows:
+ *
+ *   ATOMIC_RELAXED  not at all, but is yet atomic, as for a counter;
+ *   ATOMIC_ACQUIRE  a read: none thereafter may be moved before it;
+ *   ATOMIC_RELEASE  a write: none theretofore may be moved after it;
+ *   ATOMIC_ACQ_REL  both, for a read-modify-write;
+ *   ATOMIC_SEQ_CST  both, and every such operation occurs in a single order
+ *                   agreed upon by every thread.
+ *
+ * A write by ATOMIC_RELEASE which is read by ATOMIC_ACQUIRE thus publishes
+ * every write preceding it, as for a flag guarding data. A plain read or
+ * write of an atomic in Zeta is by ATOMIC_SEQ_CST.
+ *
+ * For each atomic, e.g. atmnatural64_t, the following are defined:
+ *
+ *   atmnatural64load      read;
+ *   atmnatural64store     write;
+ *   atmnatural64exchange  write, returning the value replaced;
+ *   atmnatural64cas       compare-and-swap, returning whether it swapped,
+ *                         otherwise reading the value into that expected;
+ *
+ * and, for naturals, integers, and reals, atmnatural64add and -sub, fetching
+ * the value before the addition (or subtraction). Those of a natural or an
+ * integer wrap around; those of a real are by a loop of compare-and-swap.
+ */
+
+#if !defined (__GNUC__) || (!defined (__clang__) && (__GNUC__ < 4 \
+    || (__GNUC__ == 4 && __GNUC_MINOR__ < 7)))
+#error "atomic.h requires the __atomic builtins of GCC (4.7 and later) or Clang"
+#endif /* __GNUC__ */
+
+#define ATOMIC_RELAXED (__ATOMIC_RELAXED) /**< "Atomic, but unordered." */
+#define ATOMIC_ACQUIRE (__ATOMIC_ACQUIRE) /**< "Orders the reads after it." */
+#define ATOMIC_RELEASE (__ATOMIC_RELEASE) /**< "Orders the writes before it." */
+#define ATOMIC_ACQ_REL (__ATOMIC_ACQ_REL) /**< "Both of the above." */
+#define ATOMIC_SEQ_CST (__ATOMIC_SEQ_CST) /**< "Sequentially consistent." */
+
+#define ATOMIC_DEFINE(name, type)                                             \
+  typedef type atm##name##_t __attribute__ ((aligned (sizeof (type))));       \
+                                                                              \
+  static inline type                                                          \
+  atm##name##load (atm##name##_t *atomic, int order)                          \
+  {                                                                           \
+    type value;                                                               \
+                                                                              \
+    __atomic_load (atomic, &value, order);                                    \
+                                                                              \
+    return (value);                                                           \
+  }                                                                           \
+                                                                              \
+  static inline void                                                          \
+  atm##name##store (atm##name##_t *atomic, type value, int order)             \
+  {                                                                           \
+    __atomic_store (atomic, &value, order);                                   \
+  }                                                                           \
+                                                                              \
+  static inline type                                                          \
+  atm##name##exchange (atm##name##_t *atomic, type value, int order)          \
+  {                                                                           \
+    type replaced;                                                            \
+                                                                              \
+    __atomic_exchange (atomic, &value, &replaced, order);                     \
+                                                                              \
+    return (replaced);                                                        \
+  }                                                                           \
+                                                                              \
+  static inline boolean_t                                                     \
+  atm##name##cas (atm##name##_t *atomic, type *expected, type desired,        \
+                  int success, int failure)                                   \
+  {                                                                           \
+    return (__atomic_compare_exchange (atomic, expected, &desired, 0,         \
+                                       success, failure));                    \
+  }
+
+#define ATOMIC_DEFINE_WHOLE(name, type)                                       \
+  ATOMIC_DEFINE (name, type)                                                  \
+                                                                              \
+  static inline type                                                          \
+  atm##name##add (atm##name##_t *atomic, type value, int order)               \
+  {                                                                           \
+    return (__atomic_fetch_add (atomic, value, order));                       \
+  }                                                                           \
+                                                                              \
+  static inline type                                                          \
+  atm##name##sub (atm##name##_t *atomic, type value, int order)               \
+  {                                                                           \
+    return (__atomic_fetch_sub (atomic, value, order));                       \
+  }
+
+/*
+ * The __atomic builtins take reals only by load, store, exchange, and
+ * compare-and-swap, thus the addition of a real is a loop thereof, whose
+ * failure need only be relaxed as it is retried.
+ */
+
+#define ATOMIC_DEFINE_REAL(name, type)                                        \
+  ATOMIC_DEFINE (name, type)                                                  \
+                                                                              \
+  static inline type                                                          \
+  atm##name##add (atm##name##_t *atomic, type value, int order)               \
+  {                                                                           \
+    type expected = atm##name##load (atomic, ATOMIC_RELAXED);                 \
+    type desired  = expected + value;                                         \
+                                                                              \
+    while (!__atomic_compare_exchange (atomic, &expected, &desired, 1,        \
+                                       order, ATOMIC_RELAXED))                \
+      {                                                                       \
+        desired = expected + value;                                           \
+      }                                                                       \
+                                                                              \
+    return (expected);                                                        \
+  }                                                                           \
+                                                                              \
+  static inline type                                                          \
+  atm##name##sub (atm##name##_t *atomic, type value, int order)               \
+  {                                                                           \
+    return (atm##name##add (atomic, -value, order));                          \
+  }
+
+/*****************************************************************************
+*                                  Atomics                                   *
+*****************************************************************************/
+
+ATOMIC_DEFINE (boolean, boolean_t)
+
+ATOMIC_DEFINE_WHOLE (natural,   natural_t)
+ATOMIC_DEFINE_WHOLE (natural8,  natural8_t)
+ATOMIC_DEFINE_WHOLE (natural16, natural16_t)
+ATOMIC_DEFINE_WHOLE (natural32, natural32_t)
+ATOMIC_DEFINE_WHOLE (natural64, natural64_t)
+
+ATOMIC_DEFINE_WHOLE (integer,   integer_t)
+ATOMIC_DEFINE_WHOLE (integer8,  integer8_t)
+ATOMIC_DEFINE_WHOLE (integer16, integer16_t)
+ATOMIC_DEFINE_WHOLE (integer32, integer32_t)
+ATOMIC_DEFINE_WHOLE (integer64, integer64_t)
+
+ATOMIC_DEFINE_REAL (real,   real_t)
+ATOMIC_DEFINE_REAL (real32, real32_t)
+ATOMIC_DEFINE_REAL (real64, real64_t)
+
+/*
+ * A pointer is of no type of Zeta, but is atomic for the runtime, e.g. to
+ * publish by ATOMIC_RELEASE the structure it points to.
+ */
+
+ATOMIC_DEFINE (pointer, void *)
+
+/**
+ * Order the plain reads and writes around a point, without an atomic.
+ *
+ * @param order The order, e.g. ATOMIC_SEQ_CST.
+ */
+static inline void
+atmfence (int order)
+{
+  __atomic_thread_fence (order);
+}
+
+/****************************************************************************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif /* __cplusplus */
+
+#endif /* !__ATOMIC__ */
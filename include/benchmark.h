@@ -0,0 +1,142 @@
+/*****************************************************************************
+*                   Copyright (c) 2020-2021 Jack C. Lloyd.                   *
+*                            All rights reserved.                            *
+*****************************************************************************/
+
+#ifndef __BENCHMARK__
+#define __BENCHMARK__ 20261018 /**< Format: YYYY-MM-DD. */
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+/*****************************************************************************
+*                              Standard Library                              *
+*****************************************************************************/
+
+#include <stddef.h>
+
+#include "context.h"
+
+/*****************************************************************************
+*                                 Data Types                                 *
+*****************************************************************************/
+
+/*
+ * The clock and the benchmarks of the standard module benchmark. The clock
+ * is monotonic, i.e. never set back, and of nanoseconds.
+ *
+ * A routine is benchmarked within a budget of time: it is first run in
+ * batches of twice as many iterations as the last, warming the caches and
+ * the branch predictor, until BENCHMARK_WARMUP of said budget has passed
+ * and a batch takes as long as a sample ought to, i.e. the rest of said
+ * budget over BENCHMARK_SAMPLES; each sample is then a batch thereof, timed
+ * as a whole, such that the clock is read but twice per sample. The time of
+ * an iteration is summarised by its percentiles over said samples, robust
+ * to those disturbed, e.g. by an interrupt.
+ *
+ * A result of a routine, never read, may be eliminated by the compiler, as
+ * may all that computes it; each is thus passed to a sink, e.g. bchsink(),
+ * which the compiler must assume reads it.
+ */
+
+#define BENCHMARK_SAMPLES (101) /**< The most samples of a benchmark. */
+#define BENCHMARK_WARMUP  (0.1) /**< The part of a budget warming up. */
+
+/**
+ * A routine to benchmark, being the body of an iteration.
+ */
+typedef void (*routine_t) (void *argument);
+
+/**
+ * A measurement data structure, summarising a benchmark; each time is that
+ * of an iteration, in nanoseconds.
+ */
+struct measurement
+{
+  natural64_t iterations; /**< The iterations per sample. */
+  size_t samples;         /**< The number of samples. */
+  real_t minimum;         /**< The least time. */
+  real_t median;          /**< The median time. */
+  real_t percentile90;    /**< The 90th percentile. */
+  real_t percentile99;    /**< The 99th percentile. */
+  real_t maximum;         /**< The greatest time. */
+  real_t mean;            /**< The mean time. */
+};
+
+/*****************************************************************************
+*                                   Clocks                                   *
+*****************************************************************************/
+
+/**
+ * The time of the monotonic clock.
+ *
+ * @return Said time, in nanoseconds since an arbitrary epoch, otherwise zero
+ *         if unavailable.
+ */
+natural64_t
+bchclock (void);
+
+/**
+ * The resolution of the monotonic clock.
+ *
+ * @return Said resolution, in nanoseconds, otherwise zero if unavailable.
+ */
+natural64_t
+bchresolution (void);
+
+/*****************************************************************************
+*                                   Sinks                                    *
+*****************************************************************************/
+
+/**
+ * Sink memory, as if read, and perhaps written, thereby.
+ *
+ * @param pointer A pointer to said memory.
+ */
+void
+bchsink (void const *pointer);
+
+/**
+ * Sink a natural, as if read thereby.
+ *
+ * @param x The natural.
+ */
+void
+bchsinknatural (natural64_t x);
+
+/**
+ * Sink a real, as if read thereby.
+ *
+ * @param x The real.
+ */
+void
+bchsinkreal (real_t x);
+
+/*****************************************************************************
+*                                 Benchmarks                                 *
+*****************************************************************************/
+
+/**
+ * Benchmark a routine.
+ *
+ * @param z        The measurement to fill in.
+ * @param routine  The routine.
+ * @param argument The argument thereof.
+ * @param seconds  The budget, in seconds, exceeded but by a routine slower
+ *                 than a sample thereof.
+ * @return         Zero on success, EXIT_MINIMISED if of no budget, otherwise
+ *                 EXIT_UNDEFINED if of no clock.
+ */
+int
+bchrun (struct measurement *z, routine_t routine, void *argument,
+        real_t seconds);
+
+/****************************************************************************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif /* __cplusplus */
+
+#endif /* !__BENCHMARK__ */
@@ -0,0 +1,134 @@
+/*****************************************************************************
+*                   Copyright (c) 2020-2021 Jack C. Lloyd.                   *
+*                            All rights reserved.                            *
+*****************************************************************************/
+
+#ifndef __CACHE__
+#define __CACHE__ 20261018 /**< Format: YYYY-MM-DD. */
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+/*****************************************************************************
+*                              Standard Library                              *
+*****************************************************************************/
+
+#include <stddef.h>
+
+/*****************************************************************************
+*                                 Data Types                                 *
+*****************************************************************************/
+
+#define CACHE_SSE2    (0x01) /**< "The CPU supports SSE2." */
+#define CACHE_SSE42   (0x02) /**< "The CPU supports SSE4.2." */
+#define CACHE_AVX     (0x04) /**< "The CPU supports AVX." */
+#define CACHE_AVX2    (0x08) /**< "The CPU supports AVX2." */
+#define CACHE_FMA     (0x10) /**< "The CPU supports FMA." */
+#define CACHE_AVX512F (0x20) /**< "The CPU supports AVX-512F." */
+
+/*
+ * The version of the translator, which the build ought to define, e.g. by
+ * -DCACHE_VERSION=\"1.2.0\", whenever the code it emits changes; otherwise
+ * each build of this file is a version of its own. It keys the cache apart
+ * from __CACHE__, the format of an entry thereof.
+ */
+
+#ifndef CACHE_VERSION
+#define CACHE_VERSION (__DATE__ " " __TIME__) /**< "Of this build." */
+#endif /* CACHE_VERSION */
+
+/**
+ * A signature data structure, identifying the machine code of a procedure;
+ * said code is reused only when every field matches.
+ */
+struct signature
+{
+  unsigned long long hash;    /**< The hash of the procedure's source. */
+  unsigned long long version; /**< The hash of CACHE_VERSION. */
+  unsigned long features;     /**< The CPU features said code requires. */
+};
+
+struct image;
+
+/*****************************************************************************
+*                           Hashing and Signatures                           *
+*****************************************************************************/
+
+/**
+ * The hashing function (64-bit FNV-1a).
+ *
+ * @param data The data to hash.
+ * @param size The size of said data, in bytes.
+ * @return     The hash value of said data.
+ * @see        cchsign().
+ */
+unsigned long long
+cchhash (void const *data, size_t size);
+
+/**
+ * The features of the CPU running the translator.
+ *
+ * @return A combination of the CACHE_ flags.
+ * @see    cchsign().
+ */
+unsigned long
+cchfeatures (void);
+
+/**
+ * Sign a procedure, under the current translator and CPU.
+ *
+ * @param signature The signature to fill in.
+ * @param source    The source of the procedure.
+ * @param size      The size of said source, in bytes.
+ * @see             cchhash() and cchfeatures().
+ */
+void
+cchsign (struct signature *signature, void const *source, size_t size);
+
+/*****************************************************************************
+*                               Save and Load                                *
+*****************************************************************************/
+
+/**
+ * Save the machine code of a procedure to a cache.
+ *
+ * @param directory   The directory of the cache.
+ * @param signature   The signature of the procedure.
+ * @param code        The machine code, compiled at address zero.
+ * @param size        The size of said code, in bytes.
+ * @param relocations The offsets of each pointer-sized slot in said code
+ *                    which holds an address relative to said code.
+ * @param count       The number of relocations.
+ * @return            Zero on success, otherwise an error code.
+ * @see               cchload().
+ */
+int
+cchsave (char const *directory, struct signature const *signature,
+         void const *code, size_t size,
+         size_t const *relocations, size_t count);
+
+/**
+ * Load the machine code of a procedure from a cache, mapping it into memory,
+ * relocating it, and making it executable; a file whose code or relocations
+ * lie beyond it is not loaded.
+ *
+ * @param directory The directory of the cache.
+ * @param signature The signature of the procedure.
+ * @param code      A pointer to the executable code, on success.
+ * @return          The image holding said code on success, to be freed by
+ *                  imgfree(), otherwise a null-pointer.
+ * @see             cchsave().
+ */
+struct image *
+cchload (char const *directory, struct signature const *signature,
+         void **code);
+
+/****************************************************************************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif /* __cplusplus */
+
+#endif /* !__CACHE__ */
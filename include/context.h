@@ -18,12 +18,13 @@ extern "C"
 #include <float.h>
 #include <limits.h>
 #include <stddef.h>
+#include <stdint.h>
 
 /*****************************************************************************
 *                                 Data Types                                 *
 *****************************************************************************/
 
-#define NATURAL_MIN (UINT_MIN) /**< The minimum value held by a natural. */
+#define NATURAL_MIN (0U)       /**< The minimum value held by a natural. */
 #define NATURAL_MAX (UINT_MAX) /**< The maximum value held by a natural. */
 #define INTEGER_MIN (INT_MIN)  /**< The minimum value held by an integer. */
 #define INTEGER_MAX (INT_MAX)  /**< The maximum value held by an integer. */
@@ -37,6 +38,17 @@ typedef double   real_t;      /**< The real number type. */
 typedef char     character_t; /**< The character type. */
 typedef char *   string_t;    /**< The string type. */
 
+typedef uint8_t  natural8_t;  /**< The natural number type of 8 bits. */
+typedef uint16_t natural16_t; /**< The natural number type of 16 bits. */
+typedef uint32_t natural32_t; /**< The natural number type of 32 bits. */
+typedef uint64_t natural64_t; /**< The natural number type of 64 bits. */
+typedef int8_t   integer8_t;  /**< The integer number type of 8 bits. */
+typedef int16_t  integer16_t; /**< The integer number type of 16 bits. */
+typedef int32_t  integer32_t; /**< The integer number type of 32 bits. */
+typedef int64_t  integer64_t; /**< The integer number type of 64 bits. */
+typedef float    real32_t;    /**< The real number type of 32 bits. */
+typedef double   real64_t;    /**< The real number type of 64 bits. */
+
 /*****************************************************************************
 *                                  Contexts                                  *
 *****************************************************************************/
@@ -127,11 +139,23 @@ ctxinsert (struct context *context, char const *key, int value);
  * @param key     The first half of a key-value pair with which to search.
  * @param value   A pointer to the second half of said key-value pair.
  * @return        Zero on success, otherwise an error code.
- * @see           ctxhash(), ctxinsert(), ctxdelete(), and ctxerror().
+ * @see           ctxhash(), ctxinsert(), ctxupdate(), and ctxerror().
  */
 int
 ctxsearch (struct context *context, char const *key, int *value);
 
+/**
+ * Update a context, replacing the value of the innermost matching key.
+ * 
+ * @param context The context to update.
+ * @param key     The first half of a key-value pair to update.
+ * @param value   The new second half of said key-value pair.
+ * @return        Zero on success, otherwise an error code.
+ * @see           ctxhash(), ctxinsert(), ctxsearch(), and ctxerror().
+ */
+int
+ctxupdate (struct context *context, char const *key, int value);
+
 /* int
 ctxdelete (struct context *context, char const *key); */
 
@@ -145,6 +169,8 @@ ctxdelete (struct context *context, char const *key); */
 #define EXIT_MAXIMISED (-0x08) /**< "Memory is maximised." */
 #define EXIT_REDEFINED (-0x10) /**< "Redefined." */
 #define EXIT_UNDEFINED (-0x20) /**< "Undefined." */
+#define EXIT_FILE      (-0x40) /**< "File failure." */
+#define EXIT_OVERFLOW  (-0x80) /**< "Arithmetic overflow." */
 
 /****************************************************************************/
 
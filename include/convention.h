@@ -0,0 +1,200 @@
+/*****************************************************************************
+*                   Copyright (c) 2020-2021 Jack C. Lloyd.                   *
+*                            All rights reserved.                            *
+*****************************************************************************/
+
+#ifndef __CONVENTION__
+#define __CONVENTION__ 20261018 /**< Format: YYYY-MM-DD. */
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+/*****************************************************************************
+*                              Standard Library                              *
+*****************************************************************************/
+
+#include <stddef.h>
+
+#include "range.h"
+
+/*****************************************************************************
+*                                 Data Types                                 *
+*****************************************************************************/
+
+/*
+ * A convention describes how a procedure is called, as by the System V AMD64
+ * convention: the first CONVENTION_GENERAL naturals, integers, characters,
+ * strings, and arrays are passed in general registers, the first
+ * CONVENTION_VECTOR reals and vectors in vector registers, and the rest upon
+ * the stack. The frame of a procedure, holding said rest and its locals, is
+ * sized as it is parsed; a leaf procedure, calling none other, whose frame
+ * fits below the stack pointer, and which allocates no strings or arrays
+ * from a struct frame, sets up no frame at all.
+ *
+ * A parameter may have a default, e.g. "x := 1", as may each thereafter;
+ * a call may omit said parameters, whose defaults are passed by the caller.
+ */
+
+#define CONVENTION_LENGTH  (16)  /**< The most parameters of a procedure. */
+#define CONVENTION_GENERAL (6)   /**< The general registers for arguments. */
+#define CONVENTION_VECTOR  (8)   /**< The vector registers for arguments. */
+#define CONVENTION_REDZONE (128) /**< The bytes below the stack pointer. */
+#define CONVENTION_ALIGN   (16)  /**< The alignment of a frame. */
+
+#define PLACE_GENERAL (0x01) /**< "In a general register." */
+#define PLACE_VECTOR  (0x02) /**< "In a vector register." */
+#define PLACE_FRAME   (0x03) /**< "In the frame." */
+
+struct node;
+
+/**
+ * A parameter data structure, placing a parameter of a procedure.
+ */
+struct parameter
+{
+  int type;             /**< The type of the parameter. */
+  int place;            /**< Where it is passed, e.g. PLACE_GENERAL. */
+  size_t index;         /**< The register, or the offset within the frame. */
+  int optional;         /**< Whether it has a default. */
+  struct range initial; /**< The range of said default. */
+};
+
+/**
+ * A convention data structure, describing how a procedure is called.
+ */
+struct convention
+{
+  struct parameter parameters[CONVENTION_LENGTH]; /**< The parameters. */
+  size_t length;     /**< The number of parameters. */
+  size_t required;   /**< The number thereof without a default. */
+  size_t general;    /**< The general registers taken. */
+  size_t vector;     /**< The vector registers taken. */
+  size_t size;       /**< The size of the frame, in bytes. */
+  int leaf;          /**< Whether it calls no procedure. */
+  int storage;       /**< Whether it holds strings or arrays. */
+  size_t sites;      /**< Its indirect calls, each of a struct site. */
+  struct node *body; /**< Its body, if pure, for evlcall(). */
+  size_t generics;   /**< Its type parameters, see generic.h. */
+  int opaque;        /**< Whether it but moves values thereof. */
+  int options;       /**< Its options and attributes, see options.h. */
+};
+
+struct conventions;
+
+/*****************************************************************************
+*                                Conventions                                 *
+*****************************************************************************/
+
+/**
+ * Allocate a table of conventions.
+ *
+ * @return An initialised table on success, otherwise a null-pointer.
+ * @see    cnvfree() and cnvreset().
+ */
+struct conventions *
+cnvalloc (void);
+
+/**
+ * Free a table of conventions.
+ *
+ * @param table The table to free.
+ * @see         cnvalloc() and cnvreset().
+ */
+void
+cnvfree (struct conventions *table);
+
+/**
+ * Reset a table of conventions, forgetting every procedure.
+ *
+ * @param table The table to reset.
+ * @return      Zero on success, otherwise an error code.
+ * @see         cnvalloc() and cnvfree().
+ */
+int
+cnvreset (struct conventions *table);
+
+/**
+ * Define the convention of a procedure, of no parameters, as a leaf.
+ *
+ * @param table The table to define the convention in.
+ * @param name  The name of the procedure.
+ * @return      Said convention, valid until the table is reset or freed, on
+ *              success, otherwise a null-pointer, as if already defined.
+ * @see         cnvsearch().
+ */
+struct convention *
+cnvdefine (struct conventions *table, char const *name);
+
+/**
+ * Search for the convention of a procedure.
+ *
+ * @param table The table to search through.
+ * @param name  The name of the procedure.
+ * @return      Said convention on success, otherwise a null-pointer.
+ * @see         cnvdefine().
+ */
+struct convention const *
+cnvsearch (struct conventions *table, char const *name);
+
+/*****************************************************************************
+*                            Parameters and Locals                           *
+*****************************************************************************/
+
+/**
+ * Add a parameter to a convention, placing it in the next free register of
+ * its kind, otherwise in the frame.
+ *
+ * @param convention The convention.
+ * @param type       The type of the parameter.
+ * @param initial    The range of its default, otherwise a null-pointer.
+ * @return           Zero on success, EXIT_MAXIMISED if there are too many,
+ *                   otherwise EXIT_UNDEFINED if it lacks a default following
+ *                   one with a default.
+ * @see              cnvlocal().
+ */
+int
+cnvparameter (struct convention *convention, int type,
+              struct range const *initial);
+
+/**
+ * Add a local to the frame of a convention.
+ *
+ * @param convention The convention.
+ * @param type       The type of the local.
+ * @return           Zero on success, otherwise an error code.
+ * @see              cnvparameter().
+ */
+int
+cnvlocal (struct convention *convention, int type);
+
+/**
+ * Check the number of arguments of a call against a convention; those
+ * omitted are passed their defaults.
+ *
+ * @param convention The convention of the procedure called.
+ * @param count      The number of arguments.
+ * @return           Zero on success, EXIT_MINIMISED if too few, otherwise
+ *                   EXIT_MAXIMISED if too many.
+ */
+int
+cnvarguments (struct convention const *convention, size_t count);
+
+/**
+ * Whether a procedure needs no frame: a leaf, whose frame fits within
+ * CONVENTION_REDZONE, and which holds no strings or arrays.
+ *
+ * @param convention The convention of the procedure.
+ * @return           Non-zero if so, otherwise zero.
+ */
+int
+cnvframeless (struct convention const *convention);
+
+/****************************************************************************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif /* __cplusplus */
+
+#endif /* !__CONVENTION__ */
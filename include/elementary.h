@@ -0,0 +1,175 @@
+/*****************************************************************************
+*                   Copyright (c) 2020-2021 Jack C. Lloyd.                   *
+*                            All rights reserved.                            *
+*****************************************************************************/
+
+#ifndef __ELEMENTARY__
+#define __ELEMENTARY__ 20261018 /**< Format: YYYY-MM-DD. */
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+/*****************************************************************************
+*                              Standard Library                              *
+*****************************************************************************/
+
+#include <stddef.h>
+
+#include "context.h"
+
+/*****************************************************************************
+*                                 Data Types                                 *
+*****************************************************************************/
+
+/*
+ * The elementary functions of the standard module math, each of a real and
+ * of an array thereof, e.g. elmexp() and elmexpv(); the latter evaluate two
+ * elements at a time, as a vector of real64x2, rather than call libm upon
+ * each. Each reduces its argument to a short range, exactly, by splitting a
+ * constant in parts, and evaluates a polynomial thereupon:
+ *
+ *   exp   x = n ln 2 + r, |r| <= ln 2 / 2, of a polynomial of degree 13;
+ *   log   x = 2^n m, m within [1 / sqrt 2, sqrt 2), of 2 atanh ((m-1)/(m+1)),
+ *         a polynomial of degree 19;
+ *   sin   x = n pi / 2 + r, |r| <= pi / 4, of pi / 2 in four parts, of 152
+ *         bits, as r is least of the x nearest a multiple thereof; of a
+ *         polynomial in r of degree 15 or, for cos r, of degree 16, chosen
+ *         by n;
+ *   cos   likewise.
+ *
+ * The greatest errors measured, against libquadmath, are 1.16 ulp of exp
+ * and 1.07 ulp of log, each of forty million arguments, and 1.19 ulp of sin
+ * and of cos, each of twenty million arguments and of the seven doubles
+ * nearest each multiple k pi / 2 reduced, i.e. k < 636620, of which the
+ * error is at most 0.5 ulp; said bounds are thus of samples, not proven.
+ * The array functions and those of a real are of the same results. An
+ * argument beyond the range thus reduced, i.e. an infinity, a NaN, a
+ * subnormal, or one of sin or cos of zero or beyond ELEMENTARY_PERIODS, is
+ * evaluated by libm, as for the exceptions and the signed zeroes thereof. A square root is exact as is, by its instruction,
+ * thus elmsqrt() is but sqrt().
+ */
+
+#define ELEMENTARY_PERIODS (1e6) /**< The greatest argument of sin reduced. */
+
+/*****************************************************************************
+*                                 Functions                                  *
+*****************************************************************************/
+
+/**
+ * The exponential of a real.
+ *
+ * @param x The real.
+ * @return  e to the power thereof.
+ */
+real_t
+elmexp (real_t x);
+
+/**
+ * The natural logarithm of a real.
+ *
+ * @param x The real.
+ * @return  Said logarithm, NaN if negative.
+ */
+real_t
+elmlog (real_t x);
+
+/**
+ * The sine of a real.
+ *
+ * @param x The real, in radians.
+ * @return  Said sine.
+ */
+real_t
+elmsin (real_t x);
+
+/**
+ * The cosine of a real.
+ *
+ * @param x The real, in radians.
+ * @return  Said cosine.
+ */
+real_t
+elmcos (real_t x);
+
+/**
+ * The square root of a real.
+ *
+ * @param x The real.
+ * @return  Said square root, NaN if negative.
+ */
+real_t
+elmsqrt (real_t x);
+
+/*****************************************************************************
+*                                   Arrays                                   *
+*****************************************************************************/
+
+/**
+ * The exponential of each element of an array.
+ *
+ * @param z      The array to write to, which may be the array read.
+ * @param x      The array to read.
+ * @param length The length of each array.
+ * @return       Zero on success, otherwise EXIT_NULLPTR.
+ * @see          elmexp().
+ */
+int
+elmexpv (real_t *z, real_t const *x, size_t length);
+
+/**
+ * The natural logarithm of each element of an array.
+ *
+ * @param z      The array to write to, which may be the array read.
+ * @param x      The array to read.
+ * @param length The length of each array.
+ * @return       Zero on success, otherwise EXIT_NULLPTR.
+ * @see          elmlog().
+ */
+int
+elmlogv (real_t *z, real_t const *x, size_t length);
+
+/**
+ * The sine of each element of an array.
+ *
+ * @param z      The array to write to, which may be the array read.
+ * @param x      The array to read.
+ * @param length The length of each array.
+ * @return       Zero on success, otherwise EXIT_NULLPTR.
+ * @see          elmsin().
+ */
+int
+elmsinv (real_t *z, real_t const *x, size_t length);
+
+/**
+ * The cosine of each element of an array.
+ *
+ * @param z      The array to write to, which may be the array read.
+ * @param x      The array to read.
+ * @param length The length of each array.
+ * @return       Zero on success, otherwise EXIT_NULLPTR.
+ * @see          elmcos().
+ */
+int
+elmcosv (real_t *z, real_t const *x, size_t length);
+
+/**
+ * The square root of each element of an array.
+ *
+ * @param z      The array to write to, which may be the array read.
+ * @param x      The array to read.
+ * @param length The length of each array.
+ * @return       Zero on success, otherwise EXIT_NULLPTR.
+ * @see          elmsqrt().
+ */
+int
+elmsqrtv (real_t *z, real_t const *x, size_t length);
+
+/****************************************************************************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif /* __cplusplus */
+
+#endif /* !__ELEMENTARY__ */
@@ -0,0 +1,187 @@
+/*****************************************************************************
+*                   Copyright (c) 2020-2021 Jack C. Lloyd.                   *
+*                            All rights reserved.                            *
+*****************************************************************************/
+
+#ifndef __EVALUATE__
+#define __EVALUATE__ 20261018 /**< Format: YYYY-MM-DD. */
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+/*****************************************************************************
+*                              Standard Library                              *
+*****************************************************************************/
+
+#include <stddef.h>
+
+#include "range.h"
+
+/*****************************************************************************
+*                                 Data Types                                 *
+*****************************************************************************/
+
+/*
+ * An evaluator holds the expressions of a program, as trees of nodes, such
+ * that a call whose arguments are constant may be evaluated as it is parsed:
+ * the body of a pure procedure, one which does nothing but return, is an
+ * expression of its parameters, thus so is any call thereto. The arithmetic
+ * is that of range.h, such that an evaluated call is as a literal, but one
+ * which would overflow, or divide by zero, is left to run time; as is one
+ * which exceeds EVALUATE_BUDGET steps, e.g. by recursing without end.
+ *
+ * Every node is held by the evaluator until it is reset or freed.
+ */
+
+#define EVALUATE_BUDGET    (65536) /**< The most steps of an evaluation. */
+#define EVALUATE_DEPTH     (64)    /**< The most calls nested therein. */
+#define EVALUATE_ARGUMENTS (16)    /**< The most arguments of a call. */
+
+struct evaluator;
+struct node;
+
+/*****************************************************************************
+*                                 Evaluators                                 *
+*****************************************************************************/
+
+/**
+ * Allocate an evaluator.
+ *
+ * @return An initialised evaluator on success, otherwise a null-pointer.
+ * @see    evlfree() and evlreset().
+ */
+struct evaluator *
+evlalloc (void);
+
+/**
+ * Free an evaluator, along with every node thereof.
+ *
+ * @param evaluator The evaluator to free.
+ * @see             evlalloc() and evlreset().
+ */
+void
+evlfree (struct evaluator *evaluator);
+
+/**
+ * Reset an evaluator, freeing every node thereof.
+ *
+ * @param evaluator The evaluator to reset.
+ * @see             evlalloc() and evlfree().
+ */
+void
+evlreset (struct evaluator *evaluator);
+
+/*****************************************************************************
+*                                   Nodes                                    *
+*****************************************************************************/
+
+/*
+ * Each function below returns a node on success, otherwise a null-pointer,
+ * which is evaluated as is an unknown value.
+ */
+
+/**
+ * A node of unknown value, e.g. a real, or a variable.
+ *
+ * @param evaluator The evaluator.
+ * @return          See above.
+ */
+struct node *
+evlunknown (struct evaluator *evaluator);
+
+/**
+ * A node of a literal, or any other constant.
+ *
+ * @param evaluator The evaluator.
+ * @param range     The range of said constant; if not constant, the node is
+ *                  unknown.
+ * @return          See above.
+ */
+struct node *
+evlliteral (struct evaluator *evaluator, struct range const *range);
+
+/**
+ * A node of a parameter of the procedure being parsed.
+ *
+ * @param evaluator The evaluator.
+ * @param index     The index of said parameter.
+ * @param type      The declared type of said parameter, e.g. KIND_NATURAL8.
+ * @return          See above.
+ */
+struct node *
+evlparameter (struct evaluator *evaluator, size_t index, int type);
+
+/**
+ * A node of an arithmetic operation.
+ *
+ * @param evaluator The evaluator.
+ * @param operator  The operator, one of '+', '-', '*', '/', and '%'.
+ * @param x         The node of the first operand.
+ * @param y         The node of the second operand.
+ * @param type      The type of said operation, e.g. KIND_NATURAL8.
+ * @return          See above.
+ */
+struct node *
+evloperator (struct evaluator *evaluator, int operator, struct node *x,
+             struct node *y, int type);
+
+/**
+ * Append an argument to a list thereof.
+ *
+ * @param evaluator The evaluator.
+ * @param list      The list, otherwise a null-pointer if empty.
+ * @param argument  The node of the argument.
+ * @return          Said list on success, otherwise a null-pointer.
+ * @see             evlcall().
+ */
+struct node *
+evlargument (struct evaluator *evaluator, struct node *list,
+             struct node *argument);
+
+/**
+ * A node of a call.
+ *
+ * @param evaluator The evaluator.
+ * @param body      A pointer to the body of the procedure called, which is
+ *                  read as the call is evaluated, as it may yet be parsed;
+ *                  otherwise a null-pointer, if not pure.
+ * @param list      The list of arguments, by evlargument().
+ * @return          See above.
+ */
+struct node *
+evlcall (struct evaluator *evaluator, struct node *const *body,
+         struct node *list);
+
+/**
+ * The number of arguments in a list thereof.
+ *
+ * @param list The list, by evlargument().
+ * @return     Said number.
+ */
+size_t
+evlcount (struct node const *list);
+
+/*****************************************************************************
+*                                 Evaluation                                 *
+*****************************************************************************/
+
+/**
+ * Evaluate a node, outside of any procedure, thus of no parameters.
+ *
+ * @param node  The node.
+ * @param range The range of its value, constant on success.
+ * @return      Zero on success, otherwise EXIT_UNDEFINED if unknown, or
+ *              EXIT_MAXIMISED if beyond EVALUATE_BUDGET or EVALUATE_DEPTH.
+ */
+int
+evlrun (struct node const *node, struct range *range);
+
+/****************************************************************************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif /* __cplusplus */
+
+#endif /* !__EVALUATE__ */
@@ -0,0 +1,143 @@
+/*****************************************************************************
+*                   Copyright (c) 2020-2021 Jack C. Lloyd.                   *
+*                            All rights reserved.                            *
+*****************************************************************************/
+
+#ifndef __FORMAT__
+#define __FORMAT__ 20261018 /**< Format: YYYY-MM-DD. */
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+/*****************************************************************************
+*                              Standard Library                              *
+*****************************************************************************/
+
+#include <stddef.h>
+
+#include "context.h"
+
+/*****************************************************************************
+*                                 Data Types                                 *
+*****************************************************************************/
+
+/*
+ * The formatted output of io, e.g. io.out ("{} of {}", i, n), whose format
+ * holds "{}" in place of each argument, and "{{" and "}}" for braces. The
+ * types of the arguments are known as a call is parsed; a constant format
+ * is thus compiled, by fmtcompile(), into operations which write each part
+ * directly, by fmtwrite(), as is each argument, by its type: a natural or an
+ * integer as its digits, and a real as the shortest decimal which reads back
+ * as said real, of its width, e.g. 0.1 of a real32 rather than the digits of
+ * its value as a real64. A format known only at run time is parsed as it is
+ * written, by fmtprint(), as is one of more than FORMAT_LENGTH operations.
+ */
+
+#define FORMAT_LENGTH (32) /**< The most operations of a format. */
+
+#define FORMAT_LITERAL   (0x01) /**< "Copy part of the format." */
+#define FORMAT_BOOLEAN   (0x02) /**< "Write a boolean." */
+#define FORMAT_NATURAL   (0x03) /**< "Write the digits of a natural." */
+#define FORMAT_INTEGER   (0x04) /**< "Write the digits of an integer." */
+#define FORMAT_REAL      (0x05) /**< "Write a real, in its shortest form." */
+#define FORMAT_CHARACTER (0x06) /**< "Write a character." */
+#define FORMAT_STRING    (0x07) /**< "Write a string." */
+#define FORMAT_REAL32    (0x08) /**< "Write a real32, in its shortest form." */
+
+/**
+ * An argument union, holding the value of an argument of any type written;
+ * a natural, an integer, or a real, of any width is widened to 64 bits.
+ */
+union argument
+{
+  boolean_t boolean;     /**< The value of a boolean. */
+  natural64_t natural;   /**< The value of a natural. */
+  integer64_t integer;   /**< The value of an integer. */
+  real_t real;           /**< The value of a real. */
+  character_t character; /**< The value of a character. */
+  string_t string;       /**< The value of a string. */
+};
+
+/**
+ * An operation data structure, writing part of a format or an argument.
+ */
+struct operation
+{
+  int kind;        /**< The kind of the operation, e.g. FORMAT_LITERAL. */
+  size_t offset;   /**< The offset of said part within the format. */
+  size_t length;   /**< The length of said part. */
+  size_t argument; /**< The index of said argument. */
+};
+
+/**
+ * A format data structure, holding the operations of a constant format.
+ */
+struct format
+{
+  char const *text;                            /**< The format. */
+  struct operation operations[FORMAT_LENGTH];  /**< Its operations. */
+  size_t length;                               /**< The number thereof. */
+};
+
+/*****************************************************************************
+*                                  Formats                                   *
+*****************************************************************************/
+
+/**
+ * Compile a constant format, of the types of the arguments written thereby.
+ *
+ * @param z         The format to fill in, referring to the text thereof.
+ * @param text      The format, which must outlive said format.
+ * @param types     The types of the arguments, e.g. KIND_NATURAL.
+ * @param count     The number thereof.
+ * @return          Zero on success, EXIT_MAXIMISED if of too many
+ *                  operations, thus written by fmtprint(), otherwise
+ *                  EXIT_UNDEFINED if invalid, as for a stray brace, a type
+ *                  which is not written, or too few or too many arguments.
+ * @see             fmtwrite().
+ */
+int
+fmtcompile (struct format *z, char const *text, int const *types,
+            size_t count);
+
+/**
+ * Write a compiled format, as does snprintf(), thus null-terminated.
+ *
+ * @param format    The format, by fmtcompile().
+ * @param buffer    The buffer to write to.
+ * @param size      The size of said buffer, in bytes.
+ * @param arguments The arguments.
+ * @return          The length written, or which would have been if said
+ *                  buffer were large enough, without the null-terminator.
+ * @see             fmtcompile().
+ */
+size_t
+fmtwrite (struct format const *format, char *buffer, size_t size,
+          union argument const *arguments);
+
+/**
+ * Write a format, parsing it as it is written.
+ *
+ * @param buffer    The buffer to write to.
+ * @param size      The size of said buffer, in bytes.
+ * @param text      The format.
+ * @param types     The types of the arguments, e.g. KIND_NATURAL.
+ * @param arguments The arguments.
+ * @param count     The number thereof.
+ * @param length    A pointer to the length written, as by fmtwrite().
+ * @return          Zero on success, otherwise EXIT_UNDEFINED if invalid, as
+ *                  by fmtcompile().
+ */
+int
+fmtprint (char *buffer, size_t size, char const *text, int const *types,
+          union argument const *arguments, size_t count, size_t *length);
+
+/****************************************************************************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif /* __cplusplus */
+
+#endif /* !__FORMAT__ */
@@ -0,0 +1,89 @@
+/*****************************************************************************
+*                   Copyright (c) 2020-2021 Jack C. Lloyd.                   *
+*                            All rights reserved.                            *
+*****************************************************************************/
+
+#ifndef __FRAME__
+#define __FRAME__ 20261018 /**< Format: YYYY-MM-DD. */
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+/*****************************************************************************
+*                              Standard Library                              *
+*****************************************************************************/
+
+#include <stddef.h>
+
+/*****************************************************************************
+*                                 Data Types                                 *
+*****************************************************************************/
+
+#define FRAME_LENGTH (4096) /**< The length of a frame's storage, in bytes. */
+#define FRAME_LIMIT  (1024) /**< The largest allocation held by a frame. */
+
+#define FRAME_LOCAL  (0x00) /**< "The value does not escape its frame." */
+#define FRAME_ESCAPE (0x01) /**< "The value escapes its frame." */
+
+struct block;
+
+/**
+ * A frame data structure, declared on the stack of a procedure, holding the
+ * strings, arrays, and temporaries which do not escape said procedure.
+ */
+struct frame
+{
+  struct block *heap; /**< The allocations too large for the storage. */
+  size_t size;        /**< The size of the storage; not the length. */
+
+  union
+  {
+    long double   align;               /**< Aligns the storage. */
+    void *        pointer;             /**< Aligns the storage. */
+    unsigned char bytes[FRAME_LENGTH]; /**< The storage. */
+  } storage;
+};
+
+/*****************************************************************************
+*                                   Frames                                   *
+*****************************************************************************/
+
+/**
+ * Initialise a frame.
+ *
+ * @param frame The frame to initialise.
+ * @see         frmalloc() and frmfree().
+ */
+void
+frminit (struct frame *frame);
+
+/**
+ * Allocate from a frame, falling back to the heap whenever the allocation
+ * exceeds FRAME_LIMIT or the remainder of the storage.
+ *
+ * @param frame The frame to allocate from.
+ * @param size  The size of the allocation, in bytes.
+ * @return      An aligned allocation on success, otherwise a null-pointer.
+ * @see         frminit() and frmfree().
+ */
+void *
+frmalloc (struct frame *frame, size_t size);
+
+/**
+ * Free a frame, releasing every allocation made from it.
+ *
+ * @param frame The frame to free.
+ * @see         frminit() and frmalloc().
+ */
+void
+frmfree (struct frame *frame);
+
+/****************************************************************************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif /* __cplusplus */
+
+#endif /* !__FRAME__ */
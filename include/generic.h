@@ -0,0 +1,135 @@
+/*****************************************************************************
+*                   Copyright (c) 2020-2021 Jack C. Lloyd.                   *
+*                            All rights reserved.                            *
+*****************************************************************************/
+
+#ifndef __GENERIC__
+#define __GENERIC__ 20261018 /**< Format: YYYY-MM-DD. */
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+/*****************************************************************************
+*                              Standard Library                              *
+*****************************************************************************/
+
+#include <stddef.h>
+
+/*****************************************************************************
+*                                 Data Types                                 *
+*****************************************************************************/
+
+/*
+ * A generic procedure, e.g. "max <T> (x : T, y : T)", is of type parameters,
+ * each of type CLASS_GENERIC, whose type arguments are deduced from those of
+ * each call; it is monomorphised, i.e. emitted once per instance thereof, as
+ * if written for said types, thus without boxing. An instance is named by its
+ * procedure and its type arguments, e.g. "max<0x20400>", and is emitted but
+ * once however often it is called.
+ *
+ * A procedure which does no more with the values of its type parameters than
+ * move them, i.e. pass, return, and copy them, is of machine code that varies
+ * only with their sizes; its instances of equal sizes share said code, e.g.
+ * those over natural32 and integer32, or over strings and arrays.
+ */
+
+#define GENERIC_LENGTH (8) /**< The most type parameters of a procedure. */
+
+/**
+ * An instance data structure, describing a generic procedure monomorphised.
+ */
+struct instance
+{
+  int arguments[GENERIC_LENGTH]; /**< The type arguments. */
+  size_t count;                  /**< The number thereof. */
+  size_t index;                  /**< The index of the instance. */
+  size_t code;                   /**< That of the instance of its code. */
+};
+
+struct instances;
+
+/*****************************************************************************
+*                                 Deduction                                  *
+*****************************************************************************/
+
+/**
+ * The type of a type parameter.
+ *
+ * @param index The index of said type parameter.
+ * @return      Said type, of CLASS_GENERIC.
+ */
+int
+gentype (size_t index);
+
+/**
+ * Deduce the type arguments of a call from the type of an argument passed to
+ * a parameter, e.g. T from "natural []" passed to "T []"; a type argument
+ * deduced from several arguments is the type to which each widens.
+ *
+ * @param parameter The type of the parameter.
+ * @param argument  The type of the argument, KIND_NONE if unknown.
+ * @param arguments The type arguments, KIND_NONE until deduced.
+ * @param count     The number thereof.
+ * @return          Zero on success, otherwise EXIT_UNDEFINED if said types
+ *                  conflict.
+ */
+int
+gendeduce (int parameter, int argument, int *arguments, size_t count);
+
+/*****************************************************************************
+*                                 Instances                                  *
+*****************************************************************************/
+
+/**
+ * Allocate a table of instances.
+ *
+ * @return An initialised table on success, otherwise a null-pointer.
+ * @see    genfree() and genreset().
+ */
+struct instances *
+genalloc (void);
+
+/**
+ * Free a table of instances.
+ *
+ * @param table The table to free.
+ * @see         genalloc() and genreset().
+ */
+void
+genfree (struct instances *table);
+
+/**
+ * Reset a table of instances, forgetting every instance.
+ *
+ * @param table The table to reset.
+ * @return      Zero on success, otherwise an error code.
+ * @see         genalloc() and genfree().
+ */
+int
+genreset (struct instances *table);
+
+/**
+ * Instantiate a generic procedure, unless already instantiated.
+ *
+ * @param table     The table of instances.
+ * @param name      The name of said procedure.
+ * @param arguments The type arguments, each known.
+ * @param count     The number thereof.
+ * @param opaque    Whether said procedure but moves values thereof, thus
+ *                  shares code between instances of equal sizes.
+ * @return          Said instance, valid until the table is reset or freed,
+ *                  on success, otherwise a null-pointer.
+ */
+struct instance const *
+geninstance (struct instances *table, char const *name, int const *arguments,
+             size_t count, int opaque);
+
+/****************************************************************************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif /* __cplusplus */
+
+#endif /* !__GENERIC__ */
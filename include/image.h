@@ -0,0 +1,168 @@
+/*****************************************************************************
+*                   Copyright (c) 2020-2021 Jack C. Lloyd.                   *
+*                            All rights reserved.                            *
+*****************************************************************************/
+
+#ifndef __IMAGE__
+#define __IMAGE__ 20261018 /**< Format: YYYY-MM-DD. */
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+/*****************************************************************************
+*                              Standard Library                              *
+*****************************************************************************/
+
+#include <stddef.h>
+
+/*****************************************************************************
+*                                   Images                                   *
+*****************************************************************************/
+
+/*
+ * An image is a heap, built by a program's initialisation phase, which may be
+ * saved to a file and later mapped back into memory in place of re-running
+ * said phase. An image may be mapped at any address, therefore values within
+ * an image must refer to one another by offset, never by pointer.
+ */
+
+struct image;
+
+/**
+ * Allocate an image.
+ *
+ * @param length The capacity of the image, in bytes.
+ * @return       An initialised image on success, otherwise a null-pointer.
+ * @see          imgload() and imgfree().
+ */
+struct image *
+imgalloc (size_t length);
+
+/**
+ * Free an image, unmapping it if it was loaded.
+ *
+ * @param image The image to free.
+ * @see         imgalloc() and imgload().
+ */
+void
+imgfree (struct image *image);
+
+/*****************************************************************************
+*                                Take and Root                               *
+*****************************************************************************/
+
+/**
+ * Take an aligned, zeroed allocation from an image.
+ *
+ * @param image The image to take from.
+ * @param size  The size of the allocation, in bytes.
+ * @return      The allocation on success, otherwise a null-pointer; always a
+ *              null-pointer for a loaded image, whose capacity is its size.
+ * @see         imgoffset() and imgpointer().
+ */
+void *
+imgtake (struct image *image, size_t size);
+
+/**
+ * The offset of a pointer into an image.
+ *
+ * @param image   The image pointed into.
+ * @param pointer The pointer, taken from said image.
+ * @return        The offset of said pointer, to be stored within the image.
+ * @see           imgtake() and imgpointer().
+ */
+size_t
+imgoffset (struct image const *image, void const *pointer);
+
+/**
+ * The pointer at an offset into an image.
+ *
+ * @param image  The image pointed into.
+ * @param offset The offset, from imgoffset().
+ * @return       The pointer on success, otherwise a null-pointer.
+ * @see          imgtake() and imgoffset().
+ */
+void *
+imgpointer (struct image const *image, size_t offset);
+
+/**
+ * The pointer at an offset into an image, of a span of bytes lying wholly
+ * within said image, such that said span may be read without further checks.
+ *
+ * @param image  The image pointed into.
+ * @param offset The offset, from imgoffset().
+ * @param size   The size of said span, in bytes.
+ * @return       The pointer on success, otherwise a null-pointer.
+ * @see          imgpointer().
+ */
+void *
+imgspan (struct image const *image, size_t offset, size_t size);
+
+/**
+ * Mark the root of an image: the module state from which every other value
+ * in said image is reached.
+ *
+ * @param image The image to mark.
+ * @param root  The root, taken from said image.
+ * @return      Zero on success, otherwise an error code.
+ * @see         imgroot().
+ */
+int
+imgmark (struct image *image, void const *root);
+
+/**
+ * The root of an image.
+ *
+ * @param image The image whose root to find.
+ * @return      The root on success, otherwise a null-pointer.
+ * @see         imgmark().
+ */
+void *
+imgroot (struct image const *image);
+
+/*****************************************************************************
+*                               Save and Load                                *
+*****************************************************************************/
+
+/**
+ * Save an image to a file.
+ *
+ * @param image The image to save.
+ * @param path  The path of said file.
+ * @return      Zero on success, otherwise an error code.
+ * @see         imgload().
+ */
+int
+imgsave (struct image const *image, char const *path);
+
+/**
+ * Load an image from a file, mapping it privately into memory, such that
+ * writes to the image never reach said file.
+ *
+ * @param path The path of the file.
+ * @return     An initialised image on success, otherwise a null-pointer.
+ * @see        imgsave() and imgfree().
+ */
+struct image *
+imgload (char const *path);
+
+/**
+ * Execute an image, remapping a loaded image read-only and executable, such
+ * that it may hold machine code; no further writes to it are permitted.
+ *
+ * @param image The image to execute.
+ * @return      Zero on success, otherwise an error code.
+ * @see         imgload().
+ */
+int
+imgexec (struct image *image);
+
+/****************************************************************************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif /* __cplusplus */
+
+#endif /* !__IMAGE__ */
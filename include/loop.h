@@ -0,0 +1,136 @@
+/*****************************************************************************
+*                   Copyright (c) 2020-2021 Jack C. Lloyd.                   *
+*                            All rights reserved.                            *
+*****************************************************************************/
+
+#ifndef __LOOP__
+#define __LOOP__ 20261018 /**< Format: YYYY-MM-DD. */
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+/*****************************************************************************
+*                              Standard Library                              *
+*****************************************************************************/
+
+#include <stddef.h>
+
+#include "range.h"
+
+/*****************************************************************************
+*                                 Data Types                                 *
+*****************************************************************************/
+
+#define LOOP_LESS          (0x01) /**< "while i < limit". */
+#define LOOP_LESS_EQUAL    (0x02) /**< "while i <= limit". */
+#define LOOP_GREATER       (0x03) /**< "while i > limit". */
+#define LOOP_GREATER_EQUAL (0x04) /**< "while i >= limit". */
+#define LOOP_NOT_EQUAL     (0x05) /**< "while i != limit". */
+
+#define LOOP_UNKNOWN (-1LL) /**< "The trips are known only at run time." */
+
+#define LOOP_FULL   (16) /**< The most trips of a loop unrolled fully. */
+#define LOOP_UNROLL (8)  /**< The most copies of a body unrolled partially. */
+#define LOOP_BUDGET (64) /**< The most operations of an unrolled body. */
+
+/**
+ * An induction data structure, describing a counted loop: a variable, from
+ * an initial value, compared with a limit before each trip, and stepped by a
+ * constant after it. An "until" loop is a "while" loop of the negation of its
+ * comparison, e.g. "until i >= n" is LOOP_LESS. A limit known only at run
+ * time, e.g. a variable, is bounded by its range, as are the trips thereof.
+ */
+struct induction
+{
+  int kind;           /**< The kind of said variable, as of its range. */
+  int compare;        /**< The comparison, e.g. LOOP_LESS. */
+  long long initial;  /**< The initial value of said variable. */
+  long long step;     /**< The step of said variable, non-zero. */
+  long long limit;    /**< The limit of said variable, its least if unknown. */
+  long long greatest; /**< The greatest value of said limit. */
+};
+
+/**
+ * An unrolling data structure, describing how a counted loop is emitted: a
+ * loop of the body copied factor times, whose copies index the variable as
+ * initial + k * step, thus without a compare or increment between them,
+ * then a loop of the remaining trips, or (if the factor is that of the trips)
+ * straight-line code alone.
+ */
+struct unroll
+{
+  long long trips;     /**< The trips, otherwise LOOP_UNKNOWN. */
+  long long factor;    /**< The copies of the body per unrolled trip. */
+  long long remainder; /**< The trips thereafter, otherwise LOOP_UNKNOWN. */
+};
+
+/*****************************************************************************
+*                                   Loops                                    *
+*****************************************************************************/
+
+/**
+ * Recognise a counted loop from the ranges of its variable's initial value,
+ * its step, and its limit, each of 32 bits; the initial value and the step
+ * must be constant, whereas the limit may be known only at run time.
+ *
+ * @param z       The induction to fill in.
+ * @param compare The comparison, e.g. LOOP_LESS.
+ * @param initial The range of the initial value.
+ * @param step    The range of the step.
+ * @param limit   The range of the limit.
+ * @return        Zero on success, otherwise EXIT_UNDEFINED.
+ * @see           lootrips().
+ */
+int
+looinduction (struct induction *z, int compare, struct range const *initial,
+              struct range const *step, struct range const *limit);
+
+/**
+ * The trips of a counted loop, i.e. the times its body is run.
+ *
+ * @param x     The induction.
+ * @param trips A pointer to said trips, LOOP_UNKNOWN if its limit is known
+ *              only at run time, unless none.
+ * @return      Zero on success, EXIT_OVERFLOW if its variable would, or of a
+ *              limit known only at run time may, step beyond its kind,
+ *              otherwise EXIT_UNDEFINED if it may never end, as for a step
+ *              away from its limit.
+ * @see         loofinal().
+ */
+int
+lootrips (struct induction const *x, long long *trips);
+
+/**
+ * The value of the variable of a counted loop after said loop, such that a
+ * use thereof needs neither the variable nor the loop.
+ *
+ * @param x     The induction.
+ * @param trips The trips, as by lootrips().
+ * @return      Said value.
+ */
+long long
+loofinal (struct induction const *x, long long trips);
+
+/**
+ * Plan the unrolling of a loop: fully, if its trips are known and few, and
+ * its body thus copied is within LOOP_BUDGET operations; otherwise partially,
+ * by the greatest power of two within LOOP_UNROLL and said budget.
+ *
+ * @param z     The unrolling to fill in.
+ * @param trips The trips, otherwise LOOP_UNKNOWN.
+ * @param cost  The operations of the body, at least one.
+ * @return      Zero on success, otherwise an error code.
+ * @see         lootrips().
+ */
+int
+looplan (struct unroll *z, long long trips, size_t cost);
+
+/****************************************************************************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif /* __cplusplus */
+
+#endif /* !__LOOP__ */
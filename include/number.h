@@ -0,0 +1,168 @@
+/*****************************************************************************
+*                   Copyright (c) 2020-2021 Jack C. Lloyd.                   *
+*                            All rights reserved.                            *
+*****************************************************************************/
+
+#ifndef __NUMBER__
+#define __NUMBER__ 20261018 /**< Format: YYYY-MM-DD. */
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+/*****************************************************************************
+*                                 Data Types                                 *
+*****************************************************************************/
+
+#define NUMBER_KARATSUBA (32) /**< The limbs above which to use Karatsuba. */
+
+struct bignum;
+
+/**
+ * A number data structure, holding a natural or an integer of arbitrary
+ * precision; its value is held inline, in a machine word, until an operation
+ * overflows said word, whereupon it is promoted to a bignum on the heap.
+ */
+struct number
+{
+  long long small;    /**< The value, whilst big is a null-pointer. */
+  struct bignum *big; /**< The value, whilst it does not fit in small. */
+};
+
+/*****************************************************************************
+*                                  Numbers                                   *
+*****************************************************************************/
+
+/**
+ * Initialise a number; never allocates.
+ *
+ * @param number The number to initialise.
+ * @param value  The value of said number.
+ * @see          numparse() and numfree().
+ */
+void
+numinit (struct number *number, long long value);
+
+/**
+ * Parse a number from a (signed) decimal literal.
+ *
+ * @param number The number to initialise.
+ * @param string The literal.
+ * @return       Zero on success, otherwise an error code.
+ * @see          numinit() and numstring().
+ */
+int
+numparse (struct number *number, char const *string);
+
+/**
+ * Copy a number.
+ *
+ * @param z The number to copy to, which must be initialised.
+ * @param x The number to copy from.
+ * @return  Zero on success, otherwise an error code.
+ * @see     numinit().
+ */
+int
+numcopy (struct number *z, struct number const *x);
+
+/**
+ * Free a number, leaving it initialised to zero.
+ *
+ * @param number The number to free.
+ * @see          numinit().
+ */
+void
+numfree (struct number *number);
+
+/**
+ * Format a number as a decimal string.
+ *
+ * @param number The number to format.
+ * @return       A string, to be freed by free(), otherwise a null-pointer.
+ * @see          numparse().
+ */
+char *
+numstring (struct number const *number);
+
+/**
+ * Compare two numbers.
+ *
+ * @param x The first number.
+ * @param y The second number.
+ * @return  Less than, equal to, or greater than zero, as x is less than,
+ *          equal to, or greater than y.
+ */
+int
+numcmp (struct number const *x, struct number const *y);
+
+/*****************************************************************************
+*                                 Arithmetic                                 *
+*****************************************************************************/
+
+/*
+ * The result of each operation may alias either operand.
+ */
+
+/**
+ * Add two numbers.
+ *
+ * @param z The sum.
+ * @param x The augend.
+ * @param y The addend.
+ * @return  Zero on success, otherwise an error code.
+ */
+int
+numadd (struct number *z, struct number const *x, struct number const *y);
+
+/**
+ * Subtract two numbers.
+ *
+ * @param z The difference.
+ * @param x The minuend.
+ * @param y The subtrahend.
+ * @return  Zero on success, otherwise an error code.
+ */
+int
+numsub (struct number *z, struct number const *x, struct number const *y);
+
+/**
+ * Multiply two numbers.
+ *
+ * @param z The product.
+ * @param x The multiplicand.
+ * @param y The multiplier.
+ * @return  Zero on success, otherwise an error code.
+ */
+int
+nummul (struct number *z, struct number const *x, struct number const *y);
+
+/**
+ * Divide two numbers, truncating towards zero.
+ *
+ * @param z The quotient.
+ * @param x The dividend.
+ * @param y The divisor.
+ * @return  Zero on success, otherwise an error code.
+ */
+int
+numdiv (struct number *z, struct number const *x, struct number const *y);
+
+/**
+ * The remainder of two numbers, with the sign of the dividend.
+ *
+ * @param z The remainder.
+ * @param x The dividend.
+ * @param y The divisor.
+ * @return  Zero on success, otherwise an error code.
+ */
+int
+nummod (struct number *z, struct number const *x, struct number const *y);
+
+/****************************************************************************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif /* __cplusplus */
+
+#endif /* !__NUMBER__ */
@@ -0,0 +1,72 @@
+/*****************************************************************************
+*                   Copyright (c) 2020-2021 Jack C. Lloyd.                   *
+*                            All rights reserved.                            *
+*****************************************************************************/
+
+#ifndef __OPTIONS__
+#define __OPTIONS__ 20261018 /**< Format: YYYY-MM-DD. */
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+/*****************************************************************************
+*                                  Options                                   *
+*****************************************************************************/
+
+/*
+ * Each option may be given on the command line, applying to every procedure,
+ * or as an attribute preceding a procedure, applying to said procedure alone:
+ *
+ *   zed -ffast-math example.zeta
+ *   @fastmath dot (x : real [], y : real []) begin ... end
+ *
+ * The hot and cold attributes, which describe a single procedure, are given
+ * as attributes alone: a cold procedure, e.g. one reporting an error, is
+ * placed apart from the rest (in .text.unlikely), as is each branch calling
+ * it, such that it takes no room in the instruction cache of hot code.
+ */
+
+#define OPTION_FASTMATH (0x01) /**< "Relax IEEE semantics for reals." */
+#define OPTION_BIGNUM   (0x02) /**< "Promote, rather than overflow, numbers." */
+#define OPTION_HOT      (0x04) /**< "Optimise, and place with hot code." */
+#define OPTION_COLD     (0x08) /**< "Place apart, as rarely called." */
+
+#if defined (__GNUC__)
+#define OPTION_HOT_CODE  __attribute__ ((hot))            /**< OPTION_HOT. */
+#define OPTION_COLD_CODE __attribute__ ((cold, noinline)) /**< OPTION_COLD. */
+#else
+#define OPTION_HOT_CODE
+#define OPTION_COLD_CODE
+#endif /* __GNUC__ */
+
+/**
+ * Parse a command-line option.
+ *
+ * @param argument The command-line argument, beginning with '-'.
+ * @param options  A pointer to the options, to which said option is added.
+ * @return         Zero on success, otherwise an error code.
+ * @see            optattribute().
+ */
+int
+optparse (char const *argument, int *options);
+
+/**
+ * Parse an attribute, the name following an '@'.
+ *
+ * @param name    The name of the attribute.
+ * @param options A pointer to the options, to which said attribute is added.
+ * @return        Zero on success, otherwise an error code.
+ * @see           optparse().
+ */
+int
+optattribute (char const *name, int *options);
+
+/****************************************************************************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif /* __cplusplus */
+
+#endif /* !__OPTIONS__ */
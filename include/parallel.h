@@ -0,0 +1,95 @@
+/*****************************************************************************
+*                   Copyright (c) 2020-2021 Jack C. Lloyd.                   *
+*                            All rights reserved.                            *
+*****************************************************************************/
+
+#ifndef __PARALLEL__
+#define __PARALLEL__ 20261018 /**< Format: YYYY-MM-DD. */
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+/*****************************************************************************
+*                              Standard Library                              *
+*****************************************************************************/
+
+#include <stddef.h>
+
+/*****************************************************************************
+*                                 Data Types                                 *
+*****************************************************************************/
+
+#define PARALLEL_THRESHOLD (4096) /**< The fewest iterations to split. */
+#define PARALLEL_OVERSPLIT (4)    /**< The chunks per thread, for balance. */
+
+/**
+ * A kernel, being the body of a loop over [begin, end); each chunk of said
+ * loop is numbered, from zero to below parchunks(), such that a reduction
+ * may accumulate a partial result per chunk, combined thereafter.
+ */
+typedef void (*kernel_t) (size_t begin, size_t end, size_t chunk,
+                          void *argument);
+
+struct pool;
+
+/*****************************************************************************
+*                                   Pools                                    *
+*****************************************************************************/
+
+/**
+ * Allocate a pool of worker threads.
+ *
+ * @param threads The number of workers, besides the caller; if zero, one
+ *                fewer than the processors online.
+ * @return        An initialised pool on success, otherwise a null-pointer.
+ * @see           parfree().
+ */
+struct pool *
+paralloc (size_t threads);
+
+/**
+ * Free a pool, joining its workers.
+ *
+ * @param pool The pool to free.
+ * @see        paralloc().
+ */
+void
+parfree (struct pool *pool);
+
+/**
+ * The number of chunks into which a pool may split a loop.
+ *
+ * @param pool The pool.
+ * @return     Said number, no less than one.
+ * @see        parfor().
+ */
+size_t
+parchunks (struct pool const *pool);
+
+/**
+ * Run a loop, whose iterations are independent, across the workers of a
+ * pool and the caller; a loop of fewer than PARALLEL_THRESHOLD iterations,
+ * or one issued whilst another runs, is run by the caller alone, as chunk
+ * zero.
+ *
+ * @param pool     The pool.
+ * @param begin    The first iteration.
+ * @param end      The iteration after the last.
+ * @param kernel   The body of said loop.
+ * @param argument The argument of said body.
+ * @return         Zero on success, otherwise an error code.
+ * @see            parchunks().
+ */
+int
+parfor (struct pool *pool, size_t begin, size_t end, kernel_t kernel,
+        void *argument);
+
+/****************************************************************************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif /* __cplusplus */
+
+#endif /* !__PARALLEL__ */
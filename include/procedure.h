@@ -0,0 +1,225 @@
+/*****************************************************************************
+*                   Copyright (c) 2020-2021 Jack C. Lloyd.                   *
+*                            All rights reserved.                            *
+*****************************************************************************/
+
+#ifndef __PROCEDURE__
+#define __PROCEDURE__ 20261018 /**< Format: YYYY-MM-DD. */
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+/*****************************************************************************
+*                              Standard Library                              *
+*****************************************************************************/
+
+#include <stddef.h>
+
+#include "atomic.h"
+
+/*****************************************************************************
+*                                 Data Types                                 *
+*****************************************************************************/
+
+typedef void (*procedure_t) (void); /**< The procedure type. */
+
+#define SITE_LENGTH    (4)  /**< The targets recorded by a call site. */
+#define SITE_WARMUP    (64) /**< The calls before a site is speculated. */
+#define SITE_SPECULATE (16) /**< Speculate if all but 1/16 of calls hit. */
+
+struct image;
+struct table;
+struct version;
+
+/**
+ * A site data structure, recording the targets of an indirect call, i.e. a
+ * call through a procedure value (the slot of said procedure), as first seen;
+ * a site is shared by the threads calling thereat, thus each of its counts is
+ * relaxed, being a hint, and each target is claimed by a compare-and-swap.
+ */
+struct site
+{
+  atmnatural64_t slots[SITE_LENGTH];  /**< The targets, by slot plus one. */
+  atmnatural64_t counts[SITE_LENGTH]; /**< The calls to each target. */
+  atmnatural64_t misses;              /**< The calls to targets unrecorded. */
+};
+
+/*****************************************************************************
+*                                   Tables                                   *
+*****************************************************************************/
+
+/*
+ * A table holds every procedure of a running program, each behind a slot, so
+ * that changed procedures may be swapped in without restarting the program.
+ * A swap is pending until the next safe point, a call to prcpoll(); frames
+ * already running the old version finish on it, and said version is released
+ * by a poll after its last frame leaves. Frames may enter and leave by any
+ * thread, even while the table is polled or a procedure defined, as a
+ * version is pinned and published atomically, by atomic.h, and a slot never
+ * moves; procedures are defined, swapped, and polled by a single thread.
+ */
+
+/**
+ * Allocate a table.
+ *
+ * @return An initialised table on success, otherwise a null-pointer.
+ * @see    prcfree().
+ */
+struct table *
+prcalloc (void);
+
+/**
+ * Free a table, along with every version of every procedure.
+ *
+ * @param table The table to free.
+ * @see         prcalloc().
+ */
+void
+prcfree (struct table *table);
+
+/**
+ * Define a procedure in a table.
+ *
+ * @param table The table to define the procedure in.
+ * @param name  The name of the procedure.
+ * @param entry The entry point of the procedure.
+ * @param hash  The hash of the procedure's source, from cchhash().
+ * @param image The image holding said entry point, released alongside the
+ *              version, or a null-pointer.
+ * @param slot  A pointer to the slot of said procedure.
+ * @return      Zero on success, otherwise an error code.
+ * @see         prcswap() and prcstale().
+ */
+int
+prcdefine (struct table *table, char const *name, procedure_t entry,
+           unsigned long long hash, struct image *image, size_t *slot);
+
+/*****************************************************************************
+*                               Enter and Leave                              *
+*****************************************************************************/
+
+/**
+ * Enter a procedure, pinning its current version until the frame leaves.
+ *
+ * @param table   The table holding the procedure.
+ * @param slot    The slot of said procedure.
+ * @param version A pointer to the version entered, for prcleave().
+ * @return        The entry point on success, otherwise a null-pointer.
+ * @see           prcleave().
+ */
+procedure_t
+prcenter (struct table *table, size_t slot, struct version **version);
+
+/**
+ * Leave a procedure, unpinning the version that was entered.
+ *
+ * @param version The version entered, from prcenter().
+ * @see           prcenter().
+ */
+void
+prcleave (struct version *version);
+
+/*****************************************************************************
+*                               Indirect Calls                               *
+*****************************************************************************/
+
+/*
+ * Each indirect call has a site, against which the first target is checked,
+ * and then the rest; a site seeing a single target, bar a few, is said to be
+ * monomorphic, such that its call may be recompiled (and swapped in) as a
+ * direct call, guarded by a comparison of slots, thus also inlined:
+ *
+ *   if (value == slot) { ...body of said procedure... }
+ *   else               { prcindirect (table, site, value, &version); ... }
+ */
+
+/**
+ * Initialise a call site.
+ *
+ * @param site The site to initialise.
+ * @see        prcindirect().
+ */
+void
+prcsite (struct site *site);
+
+/**
+ * Enter a procedure through a procedure value, recording its target; a site
+ * may be entered by several threads at once.
+ *
+ * @param table   The table holding the procedure.
+ * @param site    The site of the call.
+ * @param slot    The slot of said procedure, being said value.
+ * @param version A pointer to the version entered, for prcleave().
+ * @return        The entry point on success, otherwise a null-pointer.
+ * @see           prcenter() and prcspeculate().
+ */
+procedure_t
+prcindirect (struct table *table, struct site *site, size_t slot,
+             struct version **version);
+
+/**
+ * Whether a site is monomorphic: having seen SITE_WARMUP calls, of which
+ * all but 1 / SITE_SPECULATE were to a single target. The counts are read
+ * while yet being added to, thus the answer is a hint, which the guard of
+ * a speculated call checks.
+ *
+ * @param site The site.
+ * @param slot A pointer to the slot of said target.
+ * @return     Zero if so, otherwise EXIT_UNDEFINED.
+ * @see        prcindirect().
+ */
+int
+prcspeculate (struct site *site, size_t *slot);
+
+/*****************************************************************************
+*                            Stale, Swap, and Poll                           *
+*****************************************************************************/
+
+/**
+ * Whether a procedure's source differs from that of its newest version.
+ *
+ * @param table The table holding the procedure.
+ * @param name  The name of the procedure.
+ * @param hash  The hash of the procedure's updated source.
+ * @return      One if stale, zero if not, otherwise an error code.
+ * @see         prcswap().
+ */
+int
+prcstale (struct table *table, char const *name, unsigned long long hash);
+
+/**
+ * Swap a procedure, recompiled from updated source, into a table at the next
+ * safe point; replaces any swap already pending for said procedure.
+ *
+ * @param table The table holding the procedure.
+ * @param name  The name of the procedure.
+ * @param entry The new entry point of the procedure.
+ * @param hash  The hash of the procedure's updated source.
+ * @param image The image holding said entry point, or a null-pointer.
+ * @return      Zero on success, otherwise an error code.
+ * @see         prcstale() and prcpoll().
+ */
+int
+prcswap (struct table *table, char const *name, procedure_t entry,
+         unsigned long long hash, struct image *image);
+
+/**
+ * Poll a table at a safe point, applying every pending swap and releasing
+ * every old version without active frames.
+ *
+ * @param table The table to poll.
+ * @return      The number of swaps applied.
+ * @see         prcswap().
+ */
+size_t
+prcpoll (struct table *table);
+
+/****************************************************************************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif /* __cplusplus */
+
+#endif /* !__PROCEDURE__ */
@@ -0,0 +1,158 @@
+/*****************************************************************************
+*                   Copyright (c) 2020-2021 Jack C. Lloyd.                   *
+*                            All rights reserved.                            *
+*****************************************************************************/
+
+#ifndef __RANDOM__
+#define __RANDOM__ 20261018 /**< Format: YYYY-MM-DD. */
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+/*****************************************************************************
+*                              Standard Library                              *
+*****************************************************************************/
+
+#include <stddef.h>
+
+#include "context.h"
+
+/*****************************************************************************
+*                                 Data Types                                 *
+*****************************************************************************/
+
+/*
+ * The generators of the standard module random, each a xoshiro256++: of 256
+ * bits of state, a period of 2^256 - 1, and but additions, shifts, rotations
+ * and xors per number, thus as fast in each lane of a vector as in scalar.
+ *
+ * A generator is of RANDOM_LANES streams, each 2^128 numbers ahead of the
+ * last; the numbers of a generator are those of its first stream, but for an
+ * array filled by rndfill() or rndfillreal(), whose elements are of every
+ * stream in turn, a vector of natural64x2 at a time. A generator per thread,
+ * e.g. per chunk of parfor(), is independent of each other by rndstream(),
+ * of streams 2^192 numbers apart, such that no two ever overlap.
+ *
+ * A natural below a bound is of Lemire's method, of a multiplication rather
+ * than a division but for one number in 2^64 / bound, and unbiased; a real
+ * is of the 52 most bits of a number, uniform over [0, 1) in steps of 2^-52.
+ */
+
+#define RANDOM_LANES (2) /**< The streams of a generator. */
+
+/**
+ * A random data structure, describing a generator; each word of its state is
+ * of one lane per stream, as loaded into a vector.
+ */
+struct random
+{
+  natural64_t state[4][RANDOM_LANES]; /**< The state of each stream. */
+};
+
+/*****************************************************************************
+*                                 Generators                                 *
+*****************************************************************************/
+
+/**
+ * Seed a generator, as by SplitMix64 of a seed, such that similar seeds are
+ * of dissimilar states.
+ *
+ * @param z    The generator to seed.
+ * @param seed The seed.
+ * @return     Zero on success, otherwise EXIT_NULLPTR.
+ * @see        rndstream().
+ */
+int
+rndseed (struct random *z, natural64_t seed);
+
+/**
+ * Derive an independent generator from another, e.g. one per thread.
+ *
+ * @param z     The generator to derive.
+ * @param base  The generator from which to derive it, as seeded.
+ * @param index The index of said generator, e.g. its chunk; that of zero is
+ *              but a copy of the base.
+ * @return      Zero on success, otherwise EXIT_NULLPTR.
+ * @see         rndseed().
+ */
+int
+rndstream (struct random *z, struct random const *base, size_t index);
+
+/*****************************************************************************
+*                                  Numbers                                   *
+*****************************************************************************/
+
+/**
+ * A natural, uniform over every natural of 64 bits.
+ *
+ * @param z The generator.
+ * @return  Said natural.
+ */
+natural64_t
+rndnatural (struct random *z);
+
+/**
+ * A natural below a bound, unbiased.
+ *
+ * @param z     The generator.
+ * @param bound The bound, zero of every natural of 64 bits.
+ * @return      Said natural.
+ */
+natural64_t
+rndbounded (struct random *z, natural64_t bound);
+
+/**
+ * A real, uniform over [0, 1).
+ *
+ * @param z The generator.
+ * @return  Said real.
+ */
+real_t
+rndreal (struct random *z);
+
+/**
+ * A real, uniform over [low, high).
+ *
+ * @param z    The generator.
+ * @param low  The least real.
+ * @param high The real above the greatest.
+ * @return     Said real.
+ */
+real_t
+rnduniform (struct random *z, real_t low, real_t high);
+
+/*****************************************************************************
+*                                   Arrays                                   *
+*****************************************************************************/
+
+/**
+ * Fill an array with naturals, as of rndnatural().
+ *
+ * @param z      The generator.
+ * @param array  The array.
+ * @param length The length thereof.
+ * @return       Zero on success, otherwise EXIT_NULLPTR.
+ */
+int
+rndfill (struct random *z, natural64_t *array, size_t length);
+
+/**
+ * Fill an array with reals, as of rndreal().
+ *
+ * @param z      The generator.
+ * @param array  The array.
+ * @param length The length thereof.
+ * @return       Zero on success, otherwise EXIT_NULLPTR.
+ */
+int
+rndfillreal (struct random *z, real_t *array, size_t length);
+
+/****************************************************************************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif /* __cplusplus */
+
+#endif /* !__RANDOM__ */
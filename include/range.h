@@ -0,0 +1,147 @@
+/*****************************************************************************
+*                   Copyright (c) 2020-2021 Jack C. Lloyd.                   *
+*                            All rights reserved.                            *
+*****************************************************************************/
+
+#ifndef __RANGE__
+#define __RANGE__ 20261018 /**< Format: YYYY-MM-DD. */
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+/*****************************************************************************
+*                                 Data Types                                 *
+*****************************************************************************/
+
+#define RANGE_NONE    (0x00) /**< "Neither a natural nor an integer." */
+#define RANGE_NATURAL (0x01) /**< "A natural." */
+#define RANGE_INTEGER (0x02) /**< "An integer." */
+#define RANGE_WIDE    (0x04) /**< "Of 64 bits, rather than 32." */
+
+#define RANGE_CHECKED (1) /**< "The operation must be checked at run time." */
+
+/**
+ * A range data structure, bounding the values an expression may take.
+ */
+struct range
+{
+  int kind;          /**< The kind of the expression, RANGE_NONE if unknown. */
+  long long minimum; /**< The least value said expression may take. */
+  long long maximum; /**< The greatest value said expression may take. */
+};
+
+/*****************************************************************************
+*                                   Ranges                                   *
+*****************************************************************************/
+
+/*
+ * The arithmetic functions below bound the result of an operation from the
+ * bounds of its operands, returning:
+ *
+ *   EXIT_SUCCESS   if the operation cannot overflow, thus needs no check;
+ *   RANGE_CHECKED  if the operation may overflow, thus needs a check;
+ *   EXIT_OVERFLOW  if the operation always overflows;
+ *   EXIT_UNDEFINED if the operation always divides by zero.
+ *
+ * A result is bounded by the width of its operands: 32 bits, as of natural
+ * and integer, or 64 bits if either is RANGE_WIDE, as is a literal beyond
+ * 32 bits. A bound beyond a long long saturates, such that a natural of 64
+ * bits greater than an integer thereof is of unknown bounds, thus checked.
+ */
+
+/**
+ * The range of an expression of unknown bounds.
+ *
+ * @param range The range to fill in.
+ * @see         rngliteral().
+ */
+void
+rngnone (struct range *range);
+
+/**
+ * The range of a literal.
+ *
+ * @param range   The range to fill in.
+ * @param kind    The kind of said literal.
+ * @param literal The text of said literal, unsigned.
+ * @return        Zero on success, otherwise EXIT_OVERFLOW if beyond 64 bits.
+ * @see           rngnone().
+ */
+int
+rngliteral (struct range *range, int kind, char const *literal);
+
+/**
+ * The range of a variable, being every value of its type.
+ *
+ * @param range The range to fill in.
+ * @param kind  The kind of said variable, RANGE_NATURAL or RANGE_INTEGER.
+ * @param width The width of its type, in bytes, e.g. one of a natural8.
+ * @see         rngnone().
+ */
+void
+rngwidth (struct range *range, int kind, int width);
+
+/**
+ * The range of a sum.
+ *
+ * @param z The range of the sum.
+ * @param x The range of the augend.
+ * @param y The range of the addend.
+ * @return  See above.
+ */
+int
+rngadd (struct range *z, struct range const *x, struct range const *y);
+
+/**
+ * The range of a difference.
+ *
+ * @param z The range of the difference.
+ * @param x The range of the minuend.
+ * @param y The range of the subtrahend.
+ * @return  See above.
+ */
+int
+rngsub (struct range *z, struct range const *x, struct range const *y);
+
+/**
+ * The range of a product.
+ *
+ * @param z The range of the product.
+ * @param x The range of the multiplicand.
+ * @param y The range of the multiplier.
+ * @return  See above.
+ */
+int
+rngmul (struct range *z, struct range const *x, struct range const *y);
+
+/**
+ * The range of a quotient.
+ *
+ * @param z The range of the quotient.
+ * @param x The range of the dividend.
+ * @param y The range of the divisor.
+ * @return  See above.
+ */
+int
+rngdiv (struct range *z, struct range const *x, struct range const *y);
+
+/**
+ * The range of a remainder.
+ *
+ * @param z The range of the remainder.
+ * @param x The range of the dividend.
+ * @param y The range of the divisor.
+ * @return  See above.
+ */
+int
+rngmod (struct range *z, struct range const *x, struct range const *y);
+
+/****************************************************************************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif /* __cplusplus */
+
+#endif /* !__RANGE__ */
@@ -0,0 +1,103 @@
+/*****************************************************************************
+*                   Copyright (c) 2020-2021 Jack C. Lloyd.                   *
+*                            All rights reserved.                            *
+*****************************************************************************/
+
+#ifndef __SORT__
+#define __SORT__ 20261018 /**< Format: YYYY-MM-DD. */
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+/*****************************************************************************
+*                              Standard Library                              *
+*****************************************************************************/
+
+#include <stddef.h>
+
+#include "context.h"
+
+/*****************************************************************************
+*                                  Builtins                                  *
+*****************************************************************************/
+
+/*
+ * The sorts below are those of the standard module sort, each specialised to
+ * the type of its elements, thus without a comparison by a function pointer,
+ * as for qsort() and bsearch(). Each element is compared by its key: the
+ * unsigned number of its width whose order is that of the element, i.e. a
+ * natural as is, an integer of its sign bit flipped, and a real of its bits
+ * flipped if negative (else of its sign bit flipped); thus a real is ordered
+ * totally, -0.0 before 0.0, and NaN of either sign at either end.
+ *
+ * For each type, e.g. natural32_t, the following are defined:
+ *
+ *   natural32sort    sort in ascending order: a short array by pdqsort, i.e.
+ *                    a quicksort which detects runs and, upon partitions ill
+ *                    balanced, shuffles, then falls back to a heapsort; and a
+ *                    long array by a radix sort, least significant byte
+ *                    first, skipping each byte shared by every key;
+ *   natural32search  search a sorted array by a binary search whose steps
+ *                    are free of branches, returning the index of the first
+ *                    element not less than a key, thus the length if none.
+ *
+ * Strings are sorted by stringsort(), a multikey quicksort, partitioning by
+ * a character at a time, such that no prefix shared by a partition is ever
+ * compared again, and searched by stringsearch().
+ */
+
+#define SORT_DECLARE(name, type)                                              \
+  void                                                                        \
+  name##sort (type *array, size_t length);                                    \
+                                                                              \
+  size_t                                                                      \
+  name##search (type const *array, size_t length, type key);
+
+/*****************************************************************************
+*                                   Sorts                                    *
+*****************************************************************************/
+
+SORT_DECLARE (natural8,  natural8_t)
+SORT_DECLARE (natural16, natural16_t)
+SORT_DECLARE (natural32, natural32_t)
+SORT_DECLARE (natural64, natural64_t)
+
+SORT_DECLARE (integer8,  integer8_t)
+SORT_DECLARE (integer16, integer16_t)
+SORT_DECLARE (integer32, integer32_t)
+SORT_DECLARE (integer64, integer64_t)
+
+SORT_DECLARE (real32, real32_t)
+SORT_DECLARE (real64, real64_t)
+
+/**
+ * Sort strings in ascending order, as by strcmp().
+ *
+ * @param array  The strings, each non-null.
+ * @param length The number thereof.
+ * @see          stringsearch().
+ */
+void
+stringsort (string_t *array, size_t length);
+
+/**
+ * Search sorted strings for the first not less than a key.
+ *
+ * @param array  The strings, sorted by stringsort().
+ * @param length The number thereof.
+ * @param key    The key.
+ * @return       The index of said string, thus the length if none.
+ * @see          stringsort().
+ */
+size_t
+stringsearch (string_t const *array, size_t length, char const *key);
+
+/****************************************************************************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif /* __cplusplus */
+
+#endif /* !__SORT__ */
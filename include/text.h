@@ -0,0 +1,119 @@
+/*****************************************************************************
+*                   Copyright (c) 2020-2021 Jack C. Lloyd.                   *
+*                            All rights reserved.                            *
+*****************************************************************************/
+
+#ifndef __TEXT__
+#define __TEXT__ 20261018 /**< Format: YYYY-MM-DD. */
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+/*****************************************************************************
+*                              Standard Library                              *
+*****************************************************************************/
+
+#include <stddef.h>
+
+#include "context.h"
+
+/*****************************************************************************
+*                                 Data Types                                 *
+*****************************************************************************/
+
+/*
+ * The text of the standard module text, searching and splitting strings. A
+ * slice refers to part of a string, rather than copying it, and need not be
+ * null-terminated; each function but txtreplace() thus returns slices of, or
+ * indices into, the string it is passed, valid as long as said string.
+ *
+ * A character is found as by memchr(). A pattern is searched for a block of
+ * TEXT_BLOCK positions at a time, as a vector of natural64x2: a position is
+ * a candidate only if of the first and the last characters of the pattern,
+ * which are compared, for the whole block at once, by a test of zero bytes;
+ * the rest of the pattern is compared but at each candidate, thus seldom.
+ */
+
+#define TEXT_BLOCK (16) /**< The positions filtered at once, in bytes. */
+
+/**
+ * A slice data structure, referring to part of a string.
+ */
+struct slice
+{
+  char const *text; /**< The first character of the slice. */
+  size_t length;    /**< The number thereof. */
+};
+
+/*****************************************************************************
+*                                   Slices                                   *
+*****************************************************************************/
+
+/**
+ * Slice a null-terminated string, as a whole.
+ *
+ * @param string The string.
+ * @return       Said slice, empty if a null-pointer.
+ */
+struct slice
+txtslice (char const *string);
+
+/**
+ * Find the first occurrence of a character.
+ *
+ * @param text      The text to search.
+ * @param character The character.
+ * @return          The index thereof, thus the length of the text if none.
+ */
+size_t
+txtfind (struct slice text, character_t character);
+
+/**
+ * Search for the first occurrence of a pattern.
+ *
+ * @param text    The text to search.
+ * @param pattern The pattern, found at zero if empty.
+ * @return        The index thereof, thus the length of the text if none.
+ */
+size_t
+txtsearch (struct slice text, struct slice pattern);
+
+/**
+ * Split a text by a separator, as into the parts between each occurrence.
+ *
+ * @param text      The text to split.
+ * @param separator The separator, of which a text is but one part if empty.
+ * @param parts     The array to fill in, of slices of said text.
+ * @param length    The length of said array.
+ * @return          The number of parts, of which but the first length are
+ *                  filled in, thus at least one.
+ */
+size_t
+txtsplit (struct slice text, struct slice separator, struct slice *parts,
+          size_t length);
+
+/**
+ * Replace each occurrence of a pattern, as does snprintf(), thus writing a
+ * copy null-terminated.
+ *
+ * @param buffer      The buffer to write to.
+ * @param size        The size of said buffer, in bytes.
+ * @param text        The text.
+ * @param pattern     The pattern, of which a text is copied as is if empty.
+ * @param replacement The replacement.
+ * @return            The length written, or which would have been if said
+ *                    buffer were large enough, without the null-terminator.
+ */
+size_t
+txtreplace (char *buffer, size_t size, struct slice text,
+            struct slice pattern, struct slice replacement);
+
+/****************************************************************************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif /* __cplusplus */
+
+#endif /* !__TEXT__ */
@@ -0,0 +1,168 @@
+/*****************************************************************************
+*                   Copyright (c) 2020-2021 Jack C. Lloyd.                   *
+*                            All rights reserved.                            *
+*****************************************************************************/
+
+#ifndef __TYPE__
+#define __TYPE__ 20261018 /**< Format: YYYY-MM-DD. */
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+/*****************************************************************************
+*                              Standard Library                              *
+*****************************************************************************/
+
+#include <stddef.h>
+
+/*****************************************************************************
+*                                 Data Types                                 *
+*****************************************************************************/
+
+/*
+ * A type is an int, holding whether it is a procedure in bit 29, whether it
+ * is atomic in bit 28, the base two logarithm of its lanes in bits 25 to 27,
+ * whether it is compound in bit 24, its class in bits 16 to 23, and its
+ * width, in bytes, in bits 8 to 15; bits 0 to 7 are left clear, such that a
+ * type may share the value of a context with the FRAME_* flags of frame.h.
+ * A string's width is that of a pointer, thus left clear. A type parameter
+ * holds its index in place of its width, see generic.h. A procedure, e.g.
+ * "natural ()", holds the type of its result, that of a procedure named as
+ * a value being unknown; it is passed as its slot, see procedure.h.
+ */
+
+#define CLASS_NONE      (0x000000) /**< "Of unknown type." */
+#define CLASS_BOOLEAN   (0x010000) /**< "A boolean." */
+#define CLASS_NATURAL   (0x020000) /**< "A natural." */
+#define CLASS_INTEGER   (0x040000) /**< "An integer." */
+#define CLASS_REAL      (0x080000) /**< "A real." */
+#define CLASS_CHARACTER (0x100000) /**< "A character." */
+#define CLASS_STRING    (0x200000) /**< "A string." */
+#define CLASS_GENERIC   (0x400000) /**< "A type parameter." */
+#define CLASS_MASK      (0xff0000) /**< The class of a type. */
+
+#define CLASS_COMPOUND  (0x1000000)  /**< "An array, or set thereof." */
+#define CLASS_ATOMIC    (0x10000000) /**< "Atomic, see atomic.h." */
+#define CLASS_PROCEDURE (0x20000000) /**< "A procedure, of its result." */
+
+#define WIDTH_MASK  (0x00ff00) /**< The width of a type. */
+#define WIDTH_SHIFT (8)        /**< The shift of said width. */
+
+#define LANES_MASK  (0xe000000) /**< The lanes of a (vector) type. */
+#define LANES_SHIFT (25)        /**< The shift of said lanes. */
+
+/** The bits of a type, without those of the FRAME_* flags. */
+#define KIND_MASK (CLASS_MASK | CLASS_COMPOUND | CLASS_ATOMIC | WIDTH_MASK  \
+                   | LANES_MASK | CLASS_PROCEDURE)
+
+#define KIND_NONE      (CLASS_NONE)                         /**< "unknown" */
+#define KIND_BOOLEAN   (CLASS_BOOLEAN   | 1 << WIDTH_SHIFT) /**< "boolean" */
+#define KIND_NATURAL8  (CLASS_NATURAL   | 1 << WIDTH_SHIFT) /**< "natural8" */
+#define KIND_NATURAL16 (CLASS_NATURAL   | 2 << WIDTH_SHIFT) /**< "natural16" */
+#define KIND_NATURAL32 (CLASS_NATURAL   | 4 << WIDTH_SHIFT) /**< "natural32" */
+#define KIND_NATURAL64 (CLASS_NATURAL   | 8 << WIDTH_SHIFT) /**< "natural64" */
+#define KIND_INTEGER8  (CLASS_INTEGER   | 1 << WIDTH_SHIFT) /**< "integer8" */
+#define KIND_INTEGER16 (CLASS_INTEGER   | 2 << WIDTH_SHIFT) /**< "integer16" */
+#define KIND_INTEGER32 (CLASS_INTEGER   | 4 << WIDTH_SHIFT) /**< "integer32" */
+#define KIND_INTEGER64 (CLASS_INTEGER   | 8 << WIDTH_SHIFT) /**< "integer64" */
+#define KIND_REAL32    (CLASS_REAL      | 4 << WIDTH_SHIFT) /**< "real32" */
+#define KIND_REAL64    (CLASS_REAL      | 8 << WIDTH_SHIFT) /**< "real64" */
+#define KIND_CHARACTER (CLASS_CHARACTER | 1 << WIDTH_SHIFT) /**< "character" */
+#define KIND_STRING    (CLASS_STRING)                       /**< "string" */
+
+#define KIND_NATURAL (KIND_NATURAL32) /**< "natural", i.e. natural_t. */
+#define KIND_INTEGER (KIND_INTEGER32) /**< "integer", i.e. integer_t. */
+#define KIND_REAL    (KIND_REAL64)    /**< "real", i.e. real_t. */
+
+/*****************************************************************************
+*                                   Types                                    *
+*****************************************************************************/
+
+/**
+ * The size of a type; for a compound type, that of its element, such that an
+ * array of naturals of eight bits takes a byte per element; a procedure is
+ * passed as its slot.
+ *
+ * @param type The type.
+ * @return     The size of said type in bytes, zero if unknown, as is that of
+ *             a type parameter until it is instantiated.
+ */
+size_t
+typsize (int type);
+
+/**
+ * The vector of a type, e.g. "real32 <4>", of 16, 32, or 64 bytes, thus of
+ * the width of an SSE, an AVX2, or an AVX-512 register.
+ *
+ * @param type  The type of each lane, a natural, an integer, or a real.
+ * @param lanes The number of lanes, within [1, 64].
+ * @param z     A pointer to the type of said vector.
+ * @return      Zero on success, otherwise EXIT_UNDEFINED.
+ * @see         vector.h.
+ */
+int
+typvector (int type, long long lanes, int *z);
+
+/**
+ * The atomic of a type, e.g. "atomic natural64", read and written as a whole
+ * by each thread; an atomic boolean, natural, integer, or real.
+ *
+ * @param type The type.
+ * @param z    A pointer to the type of said atomic.
+ * @return     Zero on success, otherwise EXIT_UNDEFINED.
+ * @see        atomic.h.
+ */
+int
+typatomic (int type, int *z);
+
+/**
+ * Whether a type converts implicitly, i.e. widens, to another: a natural or
+ * an integer to one of no lesser width, a natural to a wider integer, and a
+ * natural or an integer to a real whose mantissa holds its every value; a
+ * scalar converts to a vector of as many lanes as need be, by broadcasting.
+ * An atomic converts as its value, which is read (or written) as a whole.
+ *
+ * @param from The type to convert from.
+ * @param to   The type to convert to.
+ * @return     Zero if so, otherwise EXIT_UNDEFINED.
+ * @see        typwiden().
+ */
+int
+typconvert (int from, int to);
+
+/**
+ * The narrowest type to which two types both widen, thus that of an
+ * arithmetic operation thereon; an unknown type widens to an unknown type.
+ *
+ * @param x The type of the first operand.
+ * @param y The type of the second operand.
+ * @param z A pointer to the type of the result.
+ * @return  Zero on success, otherwise EXIT_UNDEFINED, as for a natural of
+ *          64 bits and an integer, which have no common type, or vectors of
+ *          differing lanes.
+ * @see     typconvert().
+ */
+int
+typwiden (int x, int y, int *z);
+
+/**
+ * The narrowest natural or integer type holding every value within bounds;
+ * a literal takes said type, thus widens to that of any other operand.
+ *
+ * @param base    CLASS_NATURAL or CLASS_INTEGER.
+ * @param minimum The least value.
+ * @param maximum The greatest value.
+ * @return        Said type, otherwise KIND_NONE.
+ */
+int
+typfit (int base, long long minimum, long long maximum);
+
+/****************************************************************************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif /* __cplusplus */
+
+#endif /* !__TYPE__ */
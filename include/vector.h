@@ -0,0 +1,224 @@
+/*****************************************************************************
+*                   Copyright (c) 2020-2021 Jack C. Lloyd.                   *
+*                            All rights reserved.                            *
+*****************************************************************************/
+
+#ifndef __VECTOR__
+#define __VECTOR__ 20261018 /**< Format: YYYY-MM-DD. */
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+/*****************************************************************************
+*                              Standard Library                              *
+*****************************************************************************/
+
+#include <string.h>
+
+#include "context.h"
+
+/*****************************************************************************
+*                                  Builtins                                  *
+*****************************************************************************/
+
+/*
+ * The vectors below are those of the type system, e.g. "real32 <4>", named
+ * as real32x4_t; each is of 16, 32, or 64 bytes. With GCC or Clang, each is
+ * a vector extension, such that its arithmetic compiles to SSE, AVX2, or
+ * AVX-512 as the target allows (else to pairs of narrower instructions);
+ * otherwise, each is a structure, and its arithmetic a loop over its lanes.
+ *
+ * For each vector, e.g. real32x4_t, the following are defined:
+ *
+ *   real32x4load     load from (an unaligned) array of lanes;
+ *   real32x4store    store to (an unaligned) array of lanes;
+ *   real32x4splat    broadcast a scalar to every lane;
+ *   real32x4add      add lane by lane, as do sub, mul, and div;
+ *   real32x4shuffle  permute the lanes, by an array of indices;
+ *   real32x4sum      reduce horizontally, as do minimum and maximum;
+ *
+ * and, for naturals and integers, real32x4mod, as do and, or, xor, and the
+ * shifts shl and shr. The lanes of an operation are evaluated as are the
+ * scalar operators of C upon said lanes.
+ */
+
+#if defined (__GNUC__)
+#define VECTOR_BUILTIN (1)
+#endif /* __GNUC__ */
+
+#if defined (__GNUC__) && !defined (__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi" /* every function is inlined */
+#endif /* __GNUC__ */
+
+#ifdef VECTOR_BUILTIN
+#define VECTOR_TYPE(name, type, lanes)                                        \
+  typedef type name##_t __attribute__ ((vector_size (sizeof (type) * lanes)));
+#define VECTOR_LANE(x, i) ((x)[i])
+#else
+#define VECTOR_TYPE(name, type, lanes)                                        \
+  typedef struct { type lane[lanes]; } name##_t;
+#define VECTOR_LANE(x, i) ((x).lane[i])
+#endif /* VECTOR_BUILTIN */
+
+#ifdef VECTOR_BUILTIN
+#define VECTOR_OPERATOR(name, verb, operator, lanes)                          \
+  static inline name##_t                                                      \
+  name##verb (name##_t x, name##_t y)                                         \
+  {                                                                           \
+    return (x operator y);                                                    \
+  }
+#else
+#define VECTOR_OPERATOR(name, verb, operator, lanes)                          \
+  static inline name##_t                                                      \
+  name##verb (name##_t x, name##_t y)                                         \
+  {                                                                           \
+    for (int i = 0; i < lanes; i++)                                           \
+      {                                                                       \
+        VECTOR_LANE (x, i) = VECTOR_LANE (x, i) operator VECTOR_LANE (y, i);  \
+      }                                                                       \
+                                                                              \
+    return (x);                                                               \
+  }
+#endif /* VECTOR_BUILTIN */
+
+/*
+ * The horizontal reductions halve the lanes at each step, rather than fold
+ * them in order, such that each step may be a single vector operation.
+ */
+
+#define VECTOR_REDUCE(name, verb, type, lanes, combine)                       \
+  static inline type                                                          \
+  name##verb (name##_t x)                                                     \
+  {                                                                           \
+    type buffer[lanes];                                                       \
+                                                                              \
+    memcpy (buffer, &x, sizeof (buffer));                                     \
+                                                                              \
+    for (int width = lanes / 2; width > 0; width /= 2)                        \
+      {                                                                       \
+        for (int i = 0; i < width; i++)                                       \
+          {                                                                   \
+            type const a = buffer[i];                                         \
+            type const b = buffer[i + width];                                 \
+                                                                              \
+            buffer[i] = combine;                                              \
+          }                                                                   \
+      }                                                                       \
+                                                                              \
+    return (buffer[0]);                                                       \
+  }
+
+#define VECTOR_DEFINE(name, type, lanes)                                      \
+  VECTOR_TYPE (name, type, lanes)                                             \
+                                                                              \
+  static inline name##_t                                                      \
+  name##load (type const *array)                                              \
+  {                                                                           \
+    name##_t x;                                                               \
+                                                                              \
+    memcpy (&x, array, sizeof (x));                                           \
+                                                                              \
+    return (x);                                                               \
+  }                                                                           \
+                                                                              \
+  static inline void                                                          \
+  name##store (type *array, name##_t x)                                       \
+  {                                                                           \
+    memcpy (array, &x, sizeof (x));                                           \
+  }                                                                           \
+                                                                              \
+  static inline name##_t                                                      \
+  name##splat (type scalar)                                                   \
+  {                                                                           \
+    name##_t x;                                                               \
+                                                                              \
+    for (int i = 0; i < lanes; i++)                                           \
+      {                                                                       \
+        VECTOR_LANE (x, i) = scalar;                                          \
+      }                                                                       \
+                                                                              \
+    return (x);                                                               \
+  }                                                                           \
+                                                                              \
+  static inline name##_t                                                      \
+  name##shuffle (name##_t x, unsigned char const *indices)                    \
+  {                                                                           \
+    name##_t z;                                                               \
+                                                                              \
+    for (int i = 0; i < lanes; i++)                                           \
+      {                                                                       \
+        VECTOR_LANE (z, i) = VECTOR_LANE (x, indices[i] % lanes);             \
+      }                                                                       \
+                                                                              \
+    return (z);                                                               \
+  }                                                                           \
+                                                                              \
+  VECTOR_OPERATOR (name, add, +, lanes)                                       \
+  VECTOR_OPERATOR (name, sub, -, lanes)                                       \
+  VECTOR_OPERATOR (name, mul, *, lanes)                                       \
+  VECTOR_OPERATOR (name, div, /, lanes)                                       \
+                                                                              \
+  VECTOR_REDUCE (name, sum,     type, lanes, a + b)                           \
+  VECTOR_REDUCE (name, minimum, type, lanes, b < a ? b : a)                   \
+  VECTOR_REDUCE (name, maximum, type, lanes, b > a ? b : a)
+
+#define VECTOR_DEFINE_WHOLE(name, type, lanes)                                \
+  VECTOR_DEFINE (name, type, lanes)                                           \
+  VECTOR_OPERATOR (name, mod, %, lanes)                                       \
+  VECTOR_OPERATOR (name, and, &, lanes)                                       \
+  VECTOR_OPERATOR (name, or,  |, lanes)                                       \
+  VECTOR_OPERATOR (name, xor, ^, lanes)                                       \
+  VECTOR_OPERATOR (name, shl, <<, lanes)                                      \
+  VECTOR_OPERATOR (name, shr, >>, lanes)
+
+/*****************************************************************************
+*                                  Vectors                                   *
+*****************************************************************************/
+
+VECTOR_DEFINE_WHOLE (natural8x16,  natural8_t,  16)
+VECTOR_DEFINE_WHOLE (natural8x32,  natural8_t,  32)
+VECTOR_DEFINE_WHOLE (natural8x64,  natural8_t,  64)
+VECTOR_DEFINE_WHOLE (natural16x8,  natural16_t,  8)
+VECTOR_DEFINE_WHOLE (natural16x16, natural16_t, 16)
+VECTOR_DEFINE_WHOLE (natural16x32, natural16_t, 32)
+VECTOR_DEFINE_WHOLE (natural32x4,  natural32_t,  4)
+VECTOR_DEFINE_WHOLE (natural32x8,  natural32_t,  8)
+VECTOR_DEFINE_WHOLE (natural32x16, natural32_t, 16)
+VECTOR_DEFINE_WHOLE (natural64x2,  natural64_t,  2)
+VECTOR_DEFINE_WHOLE (natural64x4,  natural64_t,  4)
+VECTOR_DEFINE_WHOLE (natural64x8,  natural64_t,  8)
+
+VECTOR_DEFINE_WHOLE (integer8x16,  integer8_t,  16)
+VECTOR_DEFINE_WHOLE (integer8x32,  integer8_t,  32)
+VECTOR_DEFINE_WHOLE (integer8x64,  integer8_t,  64)
+VECTOR_DEFINE_WHOLE (integer16x8,  integer16_t,  8)
+VECTOR_DEFINE_WHOLE (integer16x16, integer16_t, 16)
+VECTOR_DEFINE_WHOLE (integer16x32, integer16_t, 32)
+VECTOR_DEFINE_WHOLE (integer32x4,  integer32_t,  4)
+VECTOR_DEFINE_WHOLE (integer32x8,  integer32_t,  8)
+VECTOR_DEFINE_WHOLE (integer32x16, integer32_t, 16)
+VECTOR_DEFINE_WHOLE (integer64x2,  integer64_t,  2)
+VECTOR_DEFINE_WHOLE (integer64x4,  integer64_t,  4)
+VECTOR_DEFINE_WHOLE (integer64x8,  integer64_t,  8)
+
+VECTOR_DEFINE (real32x4,  real32_t,  4)
+VECTOR_DEFINE (real32x8,  real32_t,  8)
+VECTOR_DEFINE (real32x16, real32_t, 16)
+VECTOR_DEFINE (real64x2,  real64_t,  2)
+VECTOR_DEFINE (real64x4,  real64_t,  4)
+VECTOR_DEFINE (real64x8,  real64_t,  8)
+
+#if defined (__GNUC__) && !defined (__clang__)
+#pragma GCC diagnostic pop
+#endif /* __GNUC__ */
+
+/****************************************************************************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif /* __cplusplus */
+
+#endif /* !__VECTOR__ */
@@ -0,0 +1,259 @@
+/*****************************************************************************
+*                   Copyright (c) 2020-2021 Jack C. Lloyd.                   *
+*                            All rights reserved.                            *
+*****************************************************************************/
+
+#include "../include/array.h"
+#include "../include/atomic.h"
+
+/*****************************************************************************
+*                              Standard Library                              *
+*****************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+
+/*****************************************************************************
+*                                 Data Types                                 *
+*****************************************************************************/
+
+/**
+ * An array data structure, implemented as a reference-counted header
+ * followed by its elements and a single terminating null byte, such that
+ * an array of characters is also a string. Its count is atomic, thus copies
+ * may be shared by, and freed from, any thread: a copy is counted relaxed,
+ * as its holder already holds the array, and a free is acquire-release, so
+ * that every write by another holder precedes that freeing the data.
+ */
+struct array
+{
+  atmnatural64_t count; /**< The number of copies sharing the array. */
+  size_t length;        /**< The number of elements. */
+  size_t size;          /**< The size of each element, in bytes. */
+
+  union
+  {
+    double        align;    /**< Aligns the elements. */
+    void *        pointer;  /**< Aligns the elements. */
+    unsigned char bytes[1]; /**< The elements. */
+  } data;
+};
+
+/**
+ * Allocate an uninitialised array.
+ *
+ * @param length The number of elements.
+ * @param size   The size of each element, in bytes.
+ * @return       An array on success, otherwise a null-pointer.
+ */
+static struct array *
+arrblank (size_t length, size_t size)
+{
+  if (size != 0 && length > ((size_t)-1 - sizeof (struct array)) / size)
+    {
+      return (NULL);
+    }
+
+  struct array *array = (struct array *) malloc (sizeof (struct array)
+                                                 + length * size);
+
+  if (array == NULL)
+    {
+      return (NULL);
+    }
+
+  array->count  = 1; /* as yet unshared */
+  array->length = length;
+  array->size   = size;
+
+  array->data.bytes[length * size] = '\0';
+
+  return (array);
+}
+
+/*****************************************************************************
+*                                   Arrays                                   *
+*****************************************************************************/
+
+/**
+ * Allocate an array, every element of which is zeroed.
+ *
+ * @param length The number of elements.
+ * @param size   The size of each element, in bytes.
+ * @return       An initialised array on success, otherwise a null-pointer.
+ * @see          arrstring() and arrfree().
+ */
+struct array *
+arralloc (size_t length, size_t size)
+{
+  struct array *array = arrblank (length, size);
+
+  if (array == NULL)
+    {
+      return (NULL);
+    }
+
+  memset (array->data.bytes, 0, length * size);
+
+  return (array);
+}
+
+/**
+ * Allocate an array of characters, holding a copy of a string, whose data
+ * remains null-terminated.
+ *
+ * @param string The string to copy.
+ * @return       An initialised array on success, otherwise a null-pointer.
+ * @see          arralloc() and arrfree().
+ */
+struct array *
+arrstring (char const *string)
+{
+  if (string == NULL)
+    {
+      return (NULL);
+    }
+
+  size_t const length = strlen (string);
+
+  struct array *array = arrblank (length, sizeof (char));
+
+  if (array == NULL)
+    {
+      return (NULL);
+    }
+
+  memcpy (array->data.bytes, string, length);
+
+  return (array);
+}
+
+/**
+ * Free an array, releasing its data once no other copy shares it.
+ *
+ * @param array The array to free.
+ * @see         arralloc() and arrstring().
+ */
+void
+arrfree (struct array *array)
+{
+  if (array == NULL)
+    {
+      return;
+    }
+
+  if (atmnatural64sub (&array->count, 1, ATOMIC_ACQ_REL) == 1)
+    {
+      free (array);
+    }
+}
+
+/*****************************************************************************
+*                               Copy and Move                                *
+*****************************************************************************/
+
+/**
+ * Copy an array, sharing its data until either copy is written to.
+ *
+ * @param array The array to copy.
+ * @return      The copy, to be freed independently of the original.
+ * @see         arrmove() and arrwrite().
+ */
+struct array *
+arrcopy (struct array *array)
+{
+  if (array != NULL)
+    {
+      atmnatural64add (&array->count, 1, ATOMIC_RELAXED);
+    }
+
+  return (array);
+}
+
+/**
+ * Move an array, transferring ownership without touching its reference
+ * count; for an argument whose last use is the call it is passed to.
+ *
+ * @param array A pointer to the array to move, set to a null-pointer.
+ * @return      The moved array.
+ * @see         arrcopy().
+ */
+struct array *
+arrmove (struct array **array)
+{
+  if (array == NULL)
+    {
+      return (NULL);
+    }
+
+  struct array *moved = *array;
+
+  *array = NULL;
+
+  return (moved);
+}
+
+/*****************************************************************************
+*                               Read and Write                               *
+*****************************************************************************/
+
+/**
+ * The length of an array.
+ *
+ * @param array The array to measure.
+ * @return      The number of elements in said array.
+ * @see         arrread() and arrwrite().
+ */
+size_t
+arrlength (struct array const *array)
+{
+  return (array == NULL ? 0 : array->length);
+}
+
+/**
+ * Read from an array.
+ *
+ * @param array The array to read from.
+ * @return      A pointer to the (shared) elements of said array.
+ * @see         arrlength() and arrwrite().
+ */
+void const *
+arrread (struct array const *array)
+{
+  return (array == NULL ? NULL : array->data.bytes);
+}
+
+/**
+ * Write to an array, first copying its data if another copy shares it.
+ *
+ * @param array A pointer to the array to write to, which may be replaced.
+ * @return      A pointer to the (unshared) elements on success, otherwise a
+ *              null-pointer.
+ * @see         arrlength() and arrread().
+ */
+void *
+arrwrite (struct array **array)
+{
+  if (array == NULL || *array == NULL)
+    {
+      return (NULL);
+    }
+
+  if (atmnatural64load (&(*array)->count, ATOMIC_ACQUIRE) > 1)
+    {
+      struct array *copy = arrblank ((*array)->length, (*array)->size);
+
+      if (copy == NULL)
+        {
+          return (NULL);
+        }
+
+      memcpy (copy->data.bytes, (*array)->data.bytes,
+              (*array)->length * (*array)->size);
+
+      arrfree (*array); /* the last, were every other copy since freed */
+      *array = copy;
+    }
+
+  return ((*array)->data.bytes);
+}
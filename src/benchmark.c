@@ -0,0 +1,248 @@
+/*****************************************************************************
+*                   Copyright (c) 2020-2021 Jack C. Lloyd.                   *
+*                            All rights reserved.                            *
+*****************************************************************************/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "../include/benchmark.h"
+#include "../include/context.h"
+#include "../include/sort.h"
+
+/*****************************************************************************
+*                              Standard Library                              *
+*****************************************************************************/
+
+#include <stdlib.h>
+
+/*****************************************************************************
+*                                   POSIX                                    *
+*****************************************************************************/
+
+#include <time.h>
+
+/*****************************************************************************
+*                                 Data Types                                 *
+*****************************************************************************/
+
+#define NANOSECONDS (1000000000) /**< The nanoseconds of a second. */
+
+static natural64_t volatile naturals; /**< The sink of bchsinknatural(). */
+static real_t volatile reals;         /**< The sink of bchsinkreal(). */
+
+#ifndef __GNUC__
+static void const *volatile pointers; /**< The sink of bchsink(). */
+#endif /* __GNUC__ */
+
+/**
+ * Time a batch of iterations of a routine.
+ *
+ * @param routine    The routine.
+ * @param argument   The argument thereof.
+ * @param iterations The number of iterations.
+ * @return           The time thereof, in nanoseconds.
+ */
+static natural64_t
+bchbatch (routine_t routine, void *argument, natural64_t iterations)
+{
+  natural64_t const start = bchclock ();
+
+  for (natural64_t i = 0; i < iterations; i++)
+    {
+      routine (argument);
+    }
+
+  return (bchclock () - start);
+}
+
+/**
+ * A percentile of samples, interpolated between those nearest.
+ *
+ * @param samples The samples, sorted.
+ * @param count   The number thereof, at least one.
+ * @param rank    The percentile, within [0, 100].
+ * @return        Said percentile.
+ */
+static real_t
+bchpercentile (real_t const *samples, size_t count, real_t rank)
+{
+  real_t const position = rank / 100 * (real_t) (count - 1);
+
+  size_t const below = (size_t) position;
+  size_t const above = below + 1 < count ? below + 1 : below;
+
+  real_t const fraction = position - (real_t) below;
+
+  return (samples[below] + (samples[above] - samples[below]) * fraction);
+}
+
+/*****************************************************************************
+*                                   Clocks                                   *
+*****************************************************************************/
+
+/**
+ * The time of the monotonic clock.
+ *
+ * @return Said time, in nanoseconds since an arbitrary epoch, otherwise zero
+ *         if unavailable.
+ */
+natural64_t
+bchclock (void)
+{
+  struct timespec time;
+
+  if (clock_gettime (CLOCK_MONOTONIC, &time) != 0)
+    {
+      return (0);
+    }
+
+  return ((natural64_t) time.tv_sec * NANOSECONDS
+          + (natural64_t) time.tv_nsec);
+}
+
+/**
+ * The resolution of the monotonic clock.
+ *
+ * @return Said resolution, in nanoseconds, otherwise zero if unavailable.
+ */
+natural64_t
+bchresolution (void)
+{
+  struct timespec resolution;
+
+  if (clock_getres (CLOCK_MONOTONIC, &resolution) != 0)
+    {
+      return (0);
+    }
+
+  return ((natural64_t) resolution.tv_sec * NANOSECONDS
+          + (natural64_t) resolution.tv_nsec);
+}
+
+/*****************************************************************************
+*                                   Sinks                                    *
+*****************************************************************************/
+
+/**
+ * Sink memory, as if read, and perhaps written, thereby.
+ *
+ * @param pointer A pointer to said memory.
+ */
+void
+bchsink (void const *pointer)
+{
+#ifdef __GNUC__
+  __asm__ __volatile__ ("" : : "r" (pointer) : "memory");
+#else
+  pointers = pointer;
+#endif /* __GNUC__ */
+}
+
+/**
+ * Sink a natural, as if read thereby.
+ *
+ * @param x The natural.
+ */
+void
+bchsinknatural (natural64_t x)
+{
+  naturals = x;
+}
+
+/**
+ * Sink a real, as if read thereby.
+ *
+ * @param x The real.
+ */
+void
+bchsinkreal (real_t x)
+{
+  reals = x;
+}
+
+/*****************************************************************************
+*                                 Benchmarks                                 *
+*****************************************************************************/
+
+/**
+ * Benchmark a routine.
+ *
+ * @param z        The measurement to fill in.
+ * @param routine  The routine.
+ * @param argument The argument thereof.
+ * @param seconds  The budget, in seconds, exceeded but by a routine slower
+ *                 than a sample thereof.
+ * @return         Zero on success, EXIT_MINIMISED if of no budget, otherwise
+ *                 EXIT_UNDEFINED if of no clock.
+ */
+int
+bchrun (struct measurement *z, routine_t routine, void *argument,
+        real_t seconds)
+{
+  if (z == NULL || routine == NULL)
+    {
+      return (EXIT_NULLPTR);
+    }
+
+  if (!(seconds > 0))
+    {
+      return (EXIT_MINIMISED);
+    }
+
+  natural64_t const start = bchclock ();
+
+  if (start == 0)
+    {
+      return (EXIT_UNDEFINED);
+    }
+
+  real_t const budget = seconds * NANOSECONDS;
+  real_t const target = budget * (1 - BENCHMARK_WARMUP) / BENCHMARK_SAMPLES;
+
+  /* warm up, doubling the iterations of a batch until it takes a sample */
+
+  natural64_t iterations = 1;
+
+  for (;;)
+    {
+      real_t const time = (real_t) bchbatch (routine, argument, iterations);
+
+      if (time < target && iterations <= UINT64_MAX / 2)
+        {
+          iterations *= 2;
+        }
+      else if ((real_t) (bchclock () - start) >= budget * BENCHMARK_WARMUP)
+        {
+          break;
+        }
+    }
+
+  /* sample, until the budget is spent, but at least once */
+
+  real_t samples[BENCHMARK_SAMPLES];
+
+  size_t count = 0;
+
+  real_t sum = 0;
+
+  while (count < BENCHMARK_SAMPLES
+         && (count == 0 || (real_t) (bchclock () - start) < budget))
+    {
+      samples[count] = (real_t) bchbatch (routine, argument, iterations)
+                       / (real_t) iterations;
+      sum += samples[count++];
+    }
+
+  real64sort (samples, count);
+
+  z->iterations   = iterations;
+  z->samples      = count;
+  z->minimum      = samples[0];
+  z->median       = bchpercentile (samples, count, 50);
+  z->percentile90 = bchpercentile (samples, count, 90);
+  z->percentile99 = bchpercentile (samples, count, 99);
+  z->maximum      = samples[count - 1];
+  z->mean         = sum / (real_t) count;
+
+  return (EXIT_SUCCESS);
+}
@@ -0,0 +1,335 @@
+/*****************************************************************************
+*                   Copyright (c) 2020-2021 Jack C. Lloyd.                   *
+*                            All rights reserved.                            *
+*****************************************************************************/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "../include/cache.h"
+#include "../include/context.h"
+#include "../include/image.h"
+
+/*****************************************************************************
+*                              Standard Library                              *
+*****************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*****************************************************************************
+*                                   POSIX                                    *
+*****************************************************************************/
+
+#include <unistd.h>
+
+/*****************************************************************************
+*                                 Data Types                                 *
+*****************************************************************************/
+
+#define PATH_LENGTH (4096)
+
+/**
+ * An entry data structure, forming the root of the image in which the
+ * machine code of a procedure is cached.
+ */
+struct entry
+{
+  unsigned long format;       /**< The format of the entry, __CACHE__. */
+  struct signature signature; /**< The signature of the procedure. */
+  size_t code;                /**< The offset of the machine code. */
+  size_t size;                /**< The size of the machine code. */
+  size_t relocations;         /**< The offset of the relocations. */
+  size_t count;               /**< The number of relocations. */
+};
+
+/**
+ * The path of an entry in a cache.
+ *
+ * @param path      The path to fill in, of length PATH_LENGTH.
+ * @param directory The directory of the cache.
+ * @param signature The signature of the entry.
+ * @return          Zero on success, otherwise an error code.
+ */
+static int
+cchpath (char *path, char const *directory, struct signature const *signature)
+{
+  int const length = snprintf (path, PATH_LENGTH, "%s/%016llx-%016llx-%lx.zc",
+                               directory, signature->hash,
+                               signature->version, signature->features);
+
+  if (length < 0 || length >= PATH_LENGTH)
+    {
+      return (EXIT_MAXIMISED);
+    }
+
+  return (EXIT_SUCCESS);
+}
+
+/*****************************************************************************
+*                           Hashing and Signatures                           *
+*****************************************************************************/
+
+/**
+ * The hashing function (64-bit FNV-1a).
+ *
+ * @param data The data to hash.
+ * @param size The size of said data, in bytes.
+ * @return     The hash value of said data.
+ * @see        cchsign().
+ */
+unsigned long long
+cchhash (void const *data, size_t size)
+{
+  unsigned long long hash = 0xcbf29ce484222325ULL;
+
+  for (unsigned char const *it = data; size-- > 0; it++)
+    {
+      hash ^= *it;
+      hash *= 0x100000001b3ULL;
+    }
+
+  return (hash);
+}
+
+/**
+ * The features of the CPU running the translator.
+ *
+ * @return A combination of the CACHE_ flags.
+ * @see    cchsign().
+ */
+unsigned long
+cchfeatures (void)
+{
+  unsigned long features = 0;
+
+#if defined (__GNUC__) && (defined (__x86_64__) || defined (__i386__))
+  __builtin_cpu_init ();
+
+  if (__builtin_cpu_supports ("sse2"))    features |= CACHE_SSE2;
+  if (__builtin_cpu_supports ("sse4.2"))  features |= CACHE_SSE42;
+  if (__builtin_cpu_supports ("avx"))     features |= CACHE_AVX;
+  if (__builtin_cpu_supports ("avx2"))    features |= CACHE_AVX2;
+  if (__builtin_cpu_supports ("fma"))     features |= CACHE_FMA;
+  if (__builtin_cpu_supports ("avx512f")) features |= CACHE_AVX512F;
+#endif /* __GNUC__ && x86 */
+
+  return (features);
+}
+
+/**
+ * Sign a procedure, under the current translator and CPU.
+ *
+ * @param signature The signature to fill in.
+ * @param source    The source of the procedure.
+ * @param size      The size of said source, in bytes.
+ * @see             cchhash() and cchfeatures().
+ */
+void
+cchsign (struct signature *signature, void const *source, size_t size)
+{
+  if (signature == NULL)
+    {
+      return;
+    }
+
+  signature->hash     = cchhash (source, size);
+  signature->version  = cchhash (CACHE_VERSION, strlen (CACHE_VERSION));
+  signature->features = cchfeatures ();
+}
+
+/*****************************************************************************
+*                               Save and Load                                *
+*****************************************************************************/
+
+/**
+ * Save the machine code of a procedure to a cache.
+ *
+ * @param directory   The directory of the cache.
+ * @param signature   The signature of the procedure.
+ * @param code        The machine code, compiled at address zero.
+ * @param size        The size of said code, in bytes.
+ * @param relocations The offsets of each pointer-sized slot in said code
+ *                    which holds an address relative to said code.
+ * @param count       The number of relocations.
+ * @return            Zero on success, otherwise an error code.
+ * @see               cchload().
+ */
+int
+cchsave (char const *directory, struct signature const *signature,
+         void const *code, size_t size,
+         size_t const *relocations, size_t count)
+{
+  if (directory == NULL || signature == NULL || code == NULL
+      || (relocations == NULL && count > 0))
+    {
+      return (EXIT_NULLPTR);
+    }
+
+  for (size_t i = 0; i < count; i++)
+    {
+      if (size < sizeof (uintptr_t)
+          || relocations[i] > size - sizeof (uintptr_t))
+        {
+          return (EXIT_UNDEFINED);
+        }
+    }
+
+  if (count > (SIZE_MAX - sizeof (struct entry) - 3 * 16) / sizeof (size_t)
+      || size > SIZE_MAX - sizeof (struct entry) - 3 * 16
+                - count * sizeof (size_t))
+    {
+      return (EXIT_MAXIMISED);
+    }
+
+  char path[PATH_LENGTH];
+  char temporary[PATH_LENGTH];
+
+  int error = cchpath (path, directory, signature);
+
+  if (error != EXIT_SUCCESS)
+    {
+      return (error);
+    }
+
+  int const length = snprintf (temporary, PATH_LENGTH, "%s.%ld", path,
+                               (long) getpid ());
+
+  if (length < 0 || length >= PATH_LENGTH)
+    {
+      return (EXIT_MAXIMISED);
+    }
+
+  struct image *image = imgalloc (sizeof (struct entry) + size
+                                  + count * sizeof (size_t) + 3 * 16);
+
+  if (image == NULL)
+    {
+      return (EXIT_MALLOC);
+    }
+
+  struct entry *entry = imgtake (image, sizeof (struct entry));
+  unsigned char *data = imgtake (image, size);
+  size_t *table       = imgtake (image, count * sizeof (size_t));
+
+  if (entry == NULL || data == NULL || (table == NULL && count > 0))
+    {
+      imgfree (image);
+
+      return (EXIT_MAXIMISED);
+    }
+
+  memcpy (data, code, size);
+  memcpy (table, relocations, count * sizeof (size_t));
+
+  entry->format      = __CACHE__;
+  entry->signature   = *signature;
+  entry->code        = imgoffset (image, data);
+  entry->size        = size;
+  entry->relocations = imgoffset (image, table);
+  entry->count       = count;
+
+  imgmark (image, entry);
+
+  /* publish atomically, such that a concurrent run never maps half a file */
+
+  if ((error = imgsave (image, temporary)) == EXIT_SUCCESS
+      && rename (temporary, path) != 0)
+    {
+      remove (temporary);
+
+      error = EXIT_FILE;
+    }
+
+  imgfree (image);
+
+  return (error);
+}
+
+/**
+ * Load the machine code of a procedure from a cache, mapping it into memory,
+ * relocating it, and making it executable; a file whose code or relocations
+ * lie beyond it is not loaded.
+ *
+ * @param directory The directory of the cache.
+ * @param signature The signature of the procedure.
+ * @param code      A pointer to the executable code, on success.
+ * @return          The image holding said code on success, to be freed by
+ *                  imgfree(), otherwise a null-pointer.
+ * @see             cchsave().
+ */
+struct image *
+cchload (char const *directory, struct signature const *signature,
+         void **code)
+{
+  if (directory == NULL || signature == NULL || code == NULL)
+    {
+      return (NULL);
+    }
+
+  char path[PATH_LENGTH];
+
+  if (cchpath (path, directory, signature) != EXIT_SUCCESS)
+    {
+      return (NULL);
+    }
+
+  struct image *image = imgload (path);
+  struct entry *entry = imgroot (image);
+
+  /* no part of the entry, its code, or its table may lie beyond said image */
+
+  if (entry == NULL
+      || imgspan (image, imgoffset (image, entry), sizeof (struct entry))
+         == NULL
+      || entry->format != __CACHE__
+      || entry->signature.hash != signature->hash
+      || entry->signature.version != signature->version
+      || entry->signature.features != signature->features)
+    {
+      imgfree (image);
+
+      return (NULL);
+    }
+
+  unsigned char *data = imgspan (image, entry->code, entry->size);
+  size_t *table       = entry->count > SIZE_MAX / sizeof (size_t) ? NULL
+                        : imgspan (image, entry->relocations,
+                                   entry->count * sizeof (size_t));
+
+  if (data == NULL || (table == NULL && entry->count > 0))
+    {
+      imgfree (image);
+
+      return (NULL);
+    }
+
+  for (size_t i = 0; i < entry->count; i++)
+    {
+      uintptr_t address;
+
+      if (entry->size < sizeof (uintptr_t)
+          || table[i] > entry->size - sizeof (uintptr_t))
+        {
+          imgfree (image);
+
+          return (NULL);
+        }
+
+      memcpy (&address, data + table[i], sizeof (uintptr_t));
+      address += (uintptr_t) data;
+      memcpy (data + table[i], &address, sizeof (uintptr_t));
+    }
+
+  if (imgexec (image) != EXIT_SUCCESS)
+    {
+      imgfree (image);
+
+      return (NULL);
+    }
+
+  *code = data;
+
+  return (image);
+}
@@ -92,6 +92,7 @@ ctxalloc (void)
     }
 
   context->head->map.size = 0;
+  context->head->tail = NULL;
 
   return (context);
 }
@@ -119,6 +120,8 @@ ctxfree (struct context *context)
 
       if (tail == NULL)
         {
+          free (context);
+
           return;
         }
       
@@ -151,12 +154,17 @@ ctxreset (struct context *context)
       head = tail;
       tail = head->tail;
     }
+
+  context->head = head;
+  context->size = 1;
   
   for (size_t i = 0; i < MAP_LENGTH; i++)
     {
       memset (context->head->map.pairs[i].key, 0, KEY_LENGTH);
               context->head->map.pairs[i].value = 0;
     }
+
+  context->head->map.size = 0;
 }
 
 /*****************************************************************************
@@ -307,7 +315,7 @@ ctxinsert (struct context *context, char const *key, int value)
  * @param key     The first half of a key-value pair with which to search.
  * @param value   A pointer to the second half of said key-value pair.
  * @return        Zero on success, otherwise an error code.
- * @see           ctxhash(), ctxinsert(), and ctxdelete()
+ * @see           ctxhash(), ctxinsert(), and ctxupdate()
  */
 int
 ctxsearch (struct context *context, char const *key, int *value)
@@ -349,5 +357,54 @@ ctxsearch (struct context *context, char const *key, int *value)
   return (EXIT_UNDEFINED);
 }
 
+/**
+ * Update a context, replacing the value of the innermost matching key.
+ * 
+ * @param context The context to update.
+ * @param key     The first half of a key-value pair to update.
+ * @param value   The new second half of said key-value pair.
+ * @return        Zero on success, otherwise an error code.
+ * @see           ctxhash(), ctxinsert(), and ctxsearch()
+ */
+int
+ctxupdate (struct context *context, char const *key, int value)
+{
+  if (context == NULL || key == NULL)
+    {
+      return (EXIT_NULLPTR);
+    }
+  
+  size_t const hash = ctxhash (key);
+
+  for (struct stack *head = context->head; head != NULL; head = head->tail)
+    {
+      if (head->map.size <= 0) // ==
+        {
+          continue;
+        }
+
+      size_t index = hash;
+
+      for (size_t count = 0; count < MAP_LENGTH; count++)
+        {
+          if (head->map.pairs[index].key[0] == '\0')
+            {
+              break;
+            }
+          
+          if (strcmp (head->map.pairs[index].key, key) == EXIT_SUCCESS)
+            {
+              head->map.pairs[index].value = value;
+              
+              return (EXIT_SUCCESS);
+            }
+
+          index = (index + 1) % MAP_LENGTH;
+        }
+    }
+  
+  return (EXIT_UNDEFINED);
+}
+
 /* int
 ctxdelete (struct context *context, char const *key); */
\ No newline at end of file
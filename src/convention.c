@@ -0,0 +1,394 @@
+/*****************************************************************************
+*                   Copyright (c) 2020-2021 Jack C. Lloyd.                   *
+*                            All rights reserved.                            *
+*****************************************************************************/
+
+#include "../include/context.h"
+#include "../include/convention.h"
+#include "../include/type.h"
+
+/*****************************************************************************
+*                              Standard Library                              *
+*****************************************************************************/
+
+#include <stdlib.h>
+
+/*****************************************************************************
+*                                 Data Types                                 *
+*****************************************************************************/
+
+#define CONVENTIONS_LENGTH (16) /**< The initial length of a table. */
+
+/**
+ * A conventions data structure, containing conventions, named by a context.
+ */
+struct conventions
+{
+  struct context *names;           /**< The index of each name. */
+  struct convention **conventions; /**< An array of conventions. */
+  size_t size;                     /**< The size thereof; not the length. */
+  size_t length;                   /**< The length thereof; not the size. */
+};
+
+/**
+ * Whether a type is held by a struct frame, rather than in a register.
+ *
+ * @param type The type.
+ * @return     Non-zero if so, otherwise zero.
+ */
+static int
+cnvstorage (int type)
+{
+  return ((type & CLASS_COMPOUND) || (type & CLASS_MASK) == CLASS_STRING);
+}
+
+/**
+ * Reserve bytes of the frame of a convention for a type, aligned thereto.
+ *
+ * @param convention The convention.
+ * @param type       The type.
+ * @return           The offset of said bytes.
+ */
+static size_t
+cnvreserve (struct convention *convention, int type)
+{
+  size_t size = cnvstorage (type) ? sizeof (void *) : typsize (type);
+
+  if (size == 0)
+    {
+      size = sizeof (void *); /* an unknown type is passed as a pointer */
+    }
+
+  size_t const align = size < CONVENTION_ALIGN ? size : CONVENTION_ALIGN;
+
+  size_t const offset = (convention->size + align - 1) / align * align;
+
+  convention->size = offset + size;
+
+  return (offset);
+}
+
+/*****************************************************************************
+*                                Conventions                                 *
+*****************************************************************************/
+
+/**
+ * Allocate a table of conventions.
+ *
+ * @return An initialised table on success, otherwise a null-pointer.
+ * @see    cnvfree() and cnvreset().
+ */
+struct conventions *
+cnvalloc (void)
+{
+  struct conventions *table = (struct conventions *)
+                              malloc (sizeof (struct conventions));
+
+  if (table == NULL)
+    {
+      return (NULL);
+    }
+
+  table->names       = ctxalloc ();
+  table->conventions = (struct convention **)
+                       malloc (CONVENTIONS_LENGTH
+                               * sizeof (struct convention *));
+  table->size        = 0;
+  table->length      = CONVENTIONS_LENGTH;
+
+  if (table->names == NULL || table->conventions == NULL)
+    {
+      ctxfree (table->names);
+      free (table->conventions);
+      free (table);
+
+      return (NULL);
+    }
+
+  return (table);
+}
+
+/**
+ * Free a table of conventions.
+ *
+ * @param table The table to free.
+ * @see         cnvalloc() and cnvreset().
+ */
+void
+cnvfree (struct conventions *table)
+{
+  if (table == NULL)
+    {
+      return;
+    }
+
+  for (size_t i = 0; i < table->size; i++)
+    {
+      free (table->conventions[i]);
+    }
+
+  ctxfree (table->names);
+  free (table->conventions);
+  free (table);
+}
+
+/**
+ * Reset a table of conventions, forgetting every procedure.
+ *
+ * @param table The table to reset.
+ * @return      Zero on success, otherwise an error code.
+ * @see         cnvalloc() and cnvfree().
+ */
+int
+cnvreset (struct conventions *table)
+{
+  if (table == NULL)
+    {
+      return (EXIT_NULLPTR);
+    }
+
+  for (size_t i = 0; i < table->size; i++)
+    {
+      free (table->conventions[i]);
+    }
+
+  ctxreset (table->names);
+
+  table->size = 0;
+
+  return (EXIT_SUCCESS);
+}
+
+/**
+ * Define the convention of a procedure, of no parameters, as a leaf.
+ *
+ * @param table The table to define the convention in.
+ * @param name  The name of the procedure.
+ * @return      Said convention, valid until the table is reset or freed, on
+ *              success, otherwise a null-pointer, as if already defined.
+ * @see         cnvsearch().
+ */
+struct convention *
+cnvdefine (struct conventions *table, char const *name)
+{
+  if (table == NULL || name == NULL)
+    {
+      return (NULL);
+    }
+
+  if (table->size >= table->length)
+    {
+      size_t const length = table->length * 2;
+
+      struct convention **conventions = (struct convention **)
+        realloc (table->conventions, length * sizeof (struct convention *));
+
+      if (conventions == NULL)
+        {
+          return (NULL);
+        }
+
+      table->conventions = conventions;
+      table->length     = length;
+    }
+
+  struct convention *convention = (struct convention *)
+                                  calloc (1, sizeof (struct convention));
+
+  if (convention == NULL)
+    {
+      return (NULL);
+    }
+
+  if (ctxinsert (table->names, name, (int) table->size) != EXIT_SUCCESS)
+    {
+      free (convention);
+
+      return (NULL);
+    }
+
+  convention->leaf   = 1;
+  convention->opaque = 1;
+
+  table->conventions[table->size++] = convention;
+
+  return (convention);
+}
+
+/**
+ * Search for the convention of a procedure.
+ *
+ * @param table The table to search through.
+ * @param name  The name of the procedure.
+ * @return      Said convention on success, otherwise a null-pointer.
+ * @see         cnvdefine().
+ */
+struct convention const *
+cnvsearch (struct conventions *table, char const *name)
+{
+  int index;
+
+  if (table == NULL || name == NULL
+      || ctxsearch (table->names, name, &index) != EXIT_SUCCESS)
+    {
+      return (NULL);
+    }
+
+  return (table->conventions[index]);
+}
+
+/*****************************************************************************
+*                            Parameters and Locals                           *
+*****************************************************************************/
+
+/**
+ * Add a parameter to a convention, placing it in the next free register of
+ * its kind, otherwise in the frame.
+ *
+ * @param convention The convention.
+ * @param type       The type of the parameter.
+ * @param initial    The range of its default, otherwise a null-pointer.
+ * @return           Zero on success, EXIT_MAXIMISED if there are too many,
+ *                   otherwise EXIT_UNDEFINED if it lacks a default following
+ *                   one with a default.
+ * @see              cnvlocal().
+ */
+int
+cnvparameter (struct convention *convention, int type,
+              struct range const *initial)
+{
+  if (convention == NULL)
+    {
+      return (EXIT_NULLPTR);
+    }
+
+  if (convention->length >= CONVENTION_LENGTH)
+    {
+      return (EXIT_MAXIMISED);
+    }
+
+  if (initial == NULL && convention->required < convention->length)
+    {
+      return (EXIT_UNDEFINED);
+    }
+
+  struct parameter *parameter = &(convention->parameters[convention->length]);
+
+  parameter->type     = type;
+  parameter->optional = initial != NULL;
+
+  if (initial != NULL)
+    {
+      parameter->initial = *initial;
+    }
+  else
+    {
+      rngnone (&parameter->initial);
+
+      convention->required++;
+    }
+
+  int const base = type & CLASS_MASK;
+
+  if (!cnvstorage (type) && !(type & CLASS_PROCEDURE)
+      && ((type & LANES_MASK) || base == CLASS_REAL))
+    {
+      if (convention->vector < CONVENTION_VECTOR)
+        {
+          parameter->place = PLACE_VECTOR;
+          parameter->index = convention->vector++;
+        }
+      else
+        {
+          parameter->place = PLACE_FRAME;
+          parameter->index = cnvreserve (convention, type);
+        }
+    }
+  else if (convention->general < CONVENTION_GENERAL)
+    {
+      parameter->place = PLACE_GENERAL;
+      parameter->index = convention->general++;
+    }
+  else
+    {
+      parameter->place = PLACE_FRAME;
+      parameter->index = cnvreserve (convention, type);
+    }
+
+  convention->storage |= cnvstorage (type);
+  convention->length++;
+
+  return (EXIT_SUCCESS);
+}
+
+/**
+ * Add a local to the frame of a convention.
+ *
+ * @param convention The convention.
+ * @param type       The type of the local.
+ * @return           Zero on success, otherwise an error code.
+ * @see              cnvparameter().
+ */
+int
+cnvlocal (struct convention *convention, int type)
+{
+  if (convention == NULL)
+    {
+      return (EXIT_NULLPTR);
+    }
+
+  cnvreserve (convention, type);
+
+  convention->storage |= cnvstorage (type);
+
+  return (EXIT_SUCCESS);
+}
+
+/**
+ * Check the number of arguments of a call against a convention; those
+ * omitted are passed their defaults.
+ *
+ * @param convention The convention of the procedure called.
+ * @param count      The number of arguments.
+ * @return           Zero on success, EXIT_MINIMISED if too few, otherwise
+ *                   EXIT_MAXIMISED if too many.
+ */
+int
+cnvarguments (struct convention const *convention, size_t count)
+{
+  if (convention == NULL)
+    {
+      return (EXIT_NULLPTR);
+    }
+
+  if (count < convention->required)
+    {
+      return (EXIT_MINIMISED);
+    }
+
+  if (count > convention->length)
+    {
+      return (EXIT_MAXIMISED);
+    }
+
+  return (EXIT_SUCCESS);
+}
+
+/**
+ * Whether a procedure needs no frame: a leaf, whose frame fits within
+ * CONVENTION_REDZONE, and which holds no strings or arrays.
+ *
+ * @param convention The convention of the procedure.
+ * @return           Non-zero if so, otherwise zero.
+ */
+int
+cnvframeless (struct convention const *convention)
+{
+  if (convention == NULL)
+    {
+      return (0);
+    }
+
+  return (convention->leaf && !convention->storage
+          && convention->size <= CONVENTION_REDZONE);
+}
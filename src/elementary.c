@@ -0,0 +1,467 @@
+/*****************************************************************************
+*                   Copyright (c) 2020-2021 Jack C. Lloyd.                   *
+*                            All rights reserved.                            *
+*****************************************************************************/
+
+#include "../include/context.h"
+#include "../include/elementary.h"
+#include "../include/vector.h"
+
+/*****************************************************************************
+*                              Standard Library                              *
+*****************************************************************************/
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*****************************************************************************
+*                                 Data Types                                 *
+*****************************************************************************/
+
+#define MAGIC      (0x1.8p52)                          /**< 1.5 * 2^52. */
+#define MAGIC_BITS ((natural64_t) 0x4338000000000000)  /**< Its bits. */
+#define ONE_BITS   ((natural64_t) 0x3ff0000000000000)  /**< Those of 1. */
+#define HALF_BITS  ((natural64_t) 0x3fe6a09e667f3bcd)  /**< 1 / sqrt 2. */
+#define MANTISSA   ((natural64_t) 0x000fffffffffffff)  /**< Its bits. */
+
+#define LOG2E    (1.44269504088896338700e+00) /**< 1 / ln 2. */
+#define LN2_HIGH (6.93147180369123816490e-01) /**< ln 2, of 32 bits. */
+#define LN2_LOW  (1.90821492927058770002e-10) /**< The rest thereof. */
+
+#define INVPIO2  (6.36619772367581382433e-01) /**< 2 / pi. */
+#define PIO2_1   (1.57079632673412561417e+00) /**< pi / 2, of 33 bits. */
+#define PIO2_2   (6.07710050630396597660e-11) /**< The next 33 thereof. */
+#define PIO2_3   (2.02226624871116645580e-21) /**< The next 33 thereof. */
+#define PIO2_3T  (8.47842766036889956997e-32) /**< The rest thereof. */
+
+#define EXP_LEAST (-708.0) /**< The least argument of exp reduced. */
+#define EXP_MOST  (709.0)  /**< The greatest argument thereof. */
+
+/* whether an argument is reduced, else evaluated by libm */
+
+#define EXP_REDUCED(x) ((x) >= EXP_LEAST && (x) <= EXP_MOST)
+#define LOG_REDUCED(x) ((x) >= DBL_MIN && (x) <= DBL_MAX)
+#define SIN_REDUCED(x) (fabs (x) <= ELEMENTARY_PERIODS && (x) != 0)
+
+/**
+ * The coefficients of exp r, from the greatest power of r, i.e. 1 / 13!.
+ */
+static real64_t const exps[] =
+{
+  1.0 / 6227020800, 1.0 / 479001600, 1.0 / 39916800, 1.0 / 3628800,
+  1.0 / 362880, 1.0 / 40320, 1.0 / 5040, 1.0 / 720, 1.0 / 120, 1.0 / 24,
+  1.0 / 6, 1.0 / 2, 1.0, 1.0,
+};
+
+/**
+ * The coefficients of (atanh (f) / f - 1) / f^2, in f^2, from the greatest
+ * power.
+ */
+static real64_t const logs[] =
+{
+  1.0 / 19, 1.0 / 17, 1.0 / 15, 1.0 / 13, 1.0 / 11, 1.0 / 9, 1.0 / 7,
+  1.0 / 5, 1.0 / 3,
+};
+
+/**
+ * The coefficients of (sin (r) / r - 1) / r^2, in r^2, from the greatest
+ * power.
+ */
+static real64_t const sines[] =
+{
+  -1.0 / 1307674368000, 1.0 / 6227020800, -1.0 / 39916800, 1.0 / 362880,
+  -1.0 / 5040, 1.0 / 120, -1.0 / 6,
+};
+
+/**
+ * The coefficients of (cos (r) - 1 + r^2 / 2) / r^4, in r^2, from the
+ * greatest power.
+ */
+static real64_t const cosines[] =
+{
+  1.0 / 20922789888000, -1.0 / 87178291200, 1.0 / 479001600,
+  -1.0 / 3628800, 1.0 / 40320, -1.0 / 720, 1.0 / 24,
+};
+
+/**
+ * The bits of each lane of a vector of reals.
+ *
+ * @param x The vector.
+ * @return  Said bits.
+ */
+static inline natural64x2_t
+elmbits (real64x2_t x)
+{
+  natural64x2_t z;
+
+  memcpy (&z, &x, sizeof (z));
+
+  return (z);
+}
+
+/**
+ * The reals of each lane of a vector of bits.
+ *
+ * @param x The vector.
+ * @return  Said reals.
+ */
+static inline real64x2_t
+elmreal (natural64x2_t x)
+{
+  real64x2_t z;
+
+  memcpy (&z, &x, sizeof (z));
+
+  return (z);
+}
+
+/**
+ * The error of a difference, by Knuth's two-sum, of no condition upon the
+ * magnitude of either term.
+ *
+ * @param x The minuend.
+ * @param y The subtrahend.
+ * @param z Their difference, x - y, as rounded.
+ * @return  Said error, such that x - y = z + said error, exactly.
+ */
+static inline real64x2_t
+elmerror (real64x2_t x, real64x2_t y, real64x2_t z)
+{
+  real64x2_t const w = real64x2sub (z, x); /* -y, as rounded */
+
+  return (real64x2sub (real64x2sub (x, real64x2sub (z, w)),
+                       real64x2add (y, w)));
+}
+
+/**
+ * Evaluate a polynomial, by Horner's method.
+ *
+ * @param x            The argument.
+ * @param coefficients The coefficients, from the greatest power.
+ * @param length       The number thereof.
+ * @return             Said polynomial of said argument.
+ */
+static inline real64x2_t
+elmhorner (real64x2_t x, real64_t const *coefficients, size_t length)
+{
+  real64x2_t z = real64x2splat (coefficients[0]);
+
+  for (size_t i = 1; i < length; i++)
+    {
+      z = real64x2add (real64x2mul (z, x), real64x2splat (coefficients[i]));
+    }
+
+  return (z);
+}
+
+/*****************************************************************************
+*                                  Kernels                                   *
+*****************************************************************************/
+
+/*
+ * Each kernel is of arguments reduced, e.g. EXP_REDUCED; an integer n is
+ * rounded as is MAGIC plus a real, thus whose bits are those of MAGIC plus
+ * n, as are converted thereafter without an instruction of conversion.
+ */
+
+/**
+ * The exponential of a vector.
+ *
+ * @param x The vector, of EXP_REDUCED lanes.
+ * @return  e to the power of each lane.
+ */
+static inline real64x2_t
+elmexpkernel (real64x2_t x)
+{
+  real64x2_t const magic = real64x2splat (MAGIC);
+
+  real64x2_t const k = real64x2add (real64x2mul (x, real64x2splat (LOG2E)),
+                                    magic);
+  real64x2_t const n = real64x2sub (k, magic);
+
+  real64x2_t const r
+    = real64x2sub (real64x2sub (x, real64x2mul (n, real64x2splat (LN2_HIGH))),
+                   real64x2mul (n, real64x2splat (LN2_LOW)));
+
+  /* 2^n, of exponent n biased */
+
+  natural64x2_t const scale
+    = natural64x2shl (natural64x2add (natural64x2sub (elmbits (k),
+                                        natural64x2splat (MAGIC_BITS)),
+                                      natural64x2splat (1023)),
+                      natural64x2splat (52));
+
+  return (real64x2mul (elmhorner (r, exps, sizeof (exps) / sizeof (*exps)),
+                       elmreal (scale)));
+}
+
+/**
+ * The natural logarithm of a vector.
+ *
+ * @param x The vector, of LOG_REDUCED lanes.
+ * @return  Said logarithm of each lane.
+ */
+static inline real64x2_t
+elmlogkernel (real64x2_t x)
+{
+  real64x2_t const one = real64x2splat (1.0);
+
+  /* x = 2^n m, m within [1 / sqrt 2, sqrt 2), by its bits offset thereby */
+
+  natural64x2_t const u = natural64x2add (elmbits (x),
+                                          natural64x2splat (ONE_BITS
+                                                            - HALF_BITS));
+
+  natural64x2_t const e = natural64x2shr (u, natural64x2splat (52));
+
+  real64x2_t const n
+    = real64x2sub (elmreal (natural64x2add (e, natural64x2splat (MAGIC_BITS))),
+                   real64x2splat (MAGIC + 1023));
+
+  real64x2_t const m
+    = elmreal (natural64x2add (natural64x2and (u,
+                                               natural64x2splat (MANTISSA)),
+                               natural64x2splat (HALF_BITS)));
+
+  /*
+   * log m = 2 atanh f = 2 f + 2 f q, f = d / (m + 1), of d = m - 1 exact;
+   * as 2 f = d - f d, log m = d - f (d - 2 q), whose error of f is thus
+   * but of the lesser term
+   */
+
+  real64x2_t const d = real64x2sub (m, one);
+  real64x2_t const f = real64x2div (d, real64x2add (m, one));
+  real64x2_t const s = real64x2mul (f, f);
+
+  real64x2_t const q
+    = real64x2mul (s, elmhorner (s, logs, sizeof (logs) / sizeof (*logs)));
+
+  real64x2_t const t
+    = real64x2sub (real64x2mul (f, real64x2sub (d, real64x2add (q, q))),
+                   real64x2mul (n, real64x2splat (LN2_LOW)));
+
+  return (real64x2add (real64x2mul (n, real64x2splat (LN2_HIGH)),
+                       real64x2sub (d, t)));
+}
+
+/**
+ * The sine, or the cosine, of a vector.
+ *
+ * @param x        The vector, of SIN_REDUCED lanes.
+ * @param quadrant Zero for said sine, one for said cosine, i.e. the number
+ *                 of quarter periods by which the latter leads.
+ * @return         Said sine, or cosine, of each lane.
+ */
+static inline real64x2_t
+elmsincos (real64x2_t x, natural64_t quadrant)
+{
+  real64x2_t const magic = real64x2splat (MAGIC);
+
+  real64x2_t const k = real64x2add (real64x2mul (x, real64x2splat (INVPIO2)),
+                                    magic);
+  real64x2_t const n = real64x2sub (k, magic);
+
+  /*
+   * each part of pi / 2 of 33 bits, times n of at most 20 bits, is exact, as
+   * is x less the first; the next two are subtracted exactly, each of its
+   * error kept, as r may be near zero, e.g. of x near a multiple of pi / 2,
+   * such that pi / 2 is taken to 152 bits: r is thus of a high part and of
+   * a low part, which are summed of said errors and of the rest
+   */
+
+  real64x2_t const a = real64x2sub (x, real64x2mul (n, real64x2splat (PIO2_1)));
+  real64x2_t const b = real64x2mul (n, real64x2splat (PIO2_2));
+  real64x2_t const c = real64x2mul (n, real64x2splat (PIO2_3));
+
+  real64x2_t const u = real64x2sub (a, b);
+  real64x2_t const v = real64x2sub (u, c);
+
+  real64x2_t const e = elmerror (a, b, u);
+  real64x2_t const f = elmerror (u, c, v);
+
+  real64x2_t const t
+    = real64x2sub (real64x2add (e, f),
+                   real64x2mul (n, real64x2splat (PIO2_3T)));
+
+  real64x2_t const high = real64x2add (v, t);
+  real64x2_t const low  = real64x2sub (t, real64x2sub (high, v));
+
+  real64x2_t const s = real64x2mul (high, high);
+
+  /* sin r = r + r^3 p + low; cos r = 1 - r^2 / 2 + r^4 p - r low */
+
+  real64x2_t const sine
+    = real64x2add (high,
+                   real64x2add (real64x2mul (real64x2mul (high, s),
+                                             elmhorner (s, sines,
+                                                        sizeof (sines)
+                                                        / sizeof (*sines))),
+                                low));
+
+  real64x2_t const half = real64x2mul (s, real64x2splat (0.5));
+  real64x2_t const w    = real64x2sub (real64x2splat (1.0), half);
+
+  real64x2_t const tail
+    = real64x2sub (real64x2mul (real64x2mul (s, s),
+                                elmhorner (s, cosines,
+                                           sizeof (cosines)
+                                           / sizeof (*cosines))),
+                   real64x2mul (high, low));
+
+  real64x2_t const cosine
+    = real64x2add (w, real64x2add (real64x2sub (real64x2sub (real64x2splat
+                                                               (1.0), w),
+                                                half),
+                                   tail));
+
+  /* of quadrant q: sin r, cos r, -sin r, then -cos r, without a branch */
+
+  natural64x2_t const q = natural64x2add (natural64x2sub (elmbits (k),
+                                            natural64x2splat (MAGIC_BITS)),
+                                          natural64x2splat (quadrant));
+
+  natural64x2_t const odd
+    = natural64x2sub (natural64x2splat (0),
+                      natural64x2and (q, natural64x2splat (1)));
+
+  natural64x2_t const sign
+    = natural64x2shl (natural64x2and (q, natural64x2splat (2)),
+                      natural64x2splat (62));
+
+  natural64x2_t const even = natural64x2xor (odd,
+                                             natural64x2splat (UINT64_MAX));
+
+  natural64x2_t const bits
+    = natural64x2or (natural64x2and (elmbits (sine), even),
+                     natural64x2and (elmbits (cosine), odd));
+
+  return (elmreal (natural64x2xor (bits, sign)));
+}
+
+/**
+ * The sine of a vector.
+ *
+ * @param x The vector, of SIN_REDUCED lanes.
+ * @return  Said sine of each lane.
+ */
+static inline real64x2_t
+elmsinkernel (real64x2_t x)
+{
+  return (elmsincos (x, 0));
+}
+
+/**
+ * The cosine of a vector.
+ *
+ * @param x The vector, of SIN_REDUCED lanes.
+ * @return  Said cosine of each lane.
+ */
+static inline real64x2_t
+elmcoskernel (real64x2_t x)
+{
+  return (elmsincos (x, 1));
+}
+
+/*****************************************************************************
+*                                 Functions                                  *
+*****************************************************************************/
+
+/*
+ * Each function of a real is its kernel of a vector, of the real in each
+ * lane; each of an array is its kernel of two elements at a time, but for
+ * those not reduced, which are written thereafter, as is the last element
+ * of an odd length.
+ */
+
+#define ELEMENTARY_DEFINE(verb, reduced)                                      \
+  real_t                                                                      \
+  elm##verb (real_t x)                                                        \
+  {                                                                           \
+    if (!reduced (x))                                                         \
+      {                                                                       \
+        return (verb (x));                                                    \
+      }                                                                       \
+                                                                              \
+    real64x2_t const z = elm##verb##kernel (real64x2splat (x));               \
+                                                                              \
+    return (VECTOR_LANE (z, 0));                                              \
+  }                                                                           \
+                                                                              \
+  int                                                                         \
+  elm##verb##v (real_t *z, real_t const *x, size_t length)                    \
+  {                                                                           \
+    if ((z == NULL || x == NULL) && length > 0)                               \
+      {                                                                       \
+        return (EXIT_NULLPTR);                                                \
+      }                                                                       \
+                                                                              \
+    size_t i = 0;                                                             \
+                                                                              \
+    for ( ; i + 2 <= length; i += 2)                                          \
+      {                                                                       \
+        real_t const a = x[i];                                                \
+        real_t const b = x[i + 1];                                            \
+                                                                              \
+        real64x2store (z + i, elm##verb##kernel (real64x2load (x + i)));      \
+                                                                              \
+        if (!reduced (a))                                                     \
+          {                                                                   \
+            z[i] = verb (a);                                                  \
+          }                                                                   \
+                                                                              \
+        if (!reduced (b))                                                     \
+          {                                                                   \
+            z[i + 1] = verb (b);                                              \
+          }                                                                   \
+      }                                                                       \
+                                                                              \
+    for ( ; i < length; i++)                                                  \
+      {                                                                       \
+        z[i] = elm##verb (x[i]);                                              \
+      }                                                                       \
+                                                                              \
+    return (EXIT_SUCCESS);                                                    \
+  }
+
+ELEMENTARY_DEFINE (exp, EXP_REDUCED)
+ELEMENTARY_DEFINE (log, LOG_REDUCED)
+ELEMENTARY_DEFINE (sin, SIN_REDUCED)
+ELEMENTARY_DEFINE (cos, SIN_REDUCED)
+
+/**
+ * The square root of a real.
+ *
+ * @param x The real.
+ * @return  Said square root, NaN if negative.
+ */
+real_t
+elmsqrt (real_t x)
+{
+  return (sqrt (x));
+}
+
+/**
+ * The square root of each element of an array.
+ *
+ * @param z      The array to write to, which may be the array read.
+ * @param x      The array to read.
+ * @param length The length of each array.
+ * @return       Zero on success, otherwise EXIT_NULLPTR.
+ * @see          elmsqrt().
+ */
+int
+elmsqrtv (real_t *z, real_t const *x, size_t length)
+{
+  if ((z == NULL || x == NULL) && length > 0)
+    {
+      return (EXIT_NULLPTR);
+    }
+
+  for (size_t i = 0; i < length; i++)
+    {
+      z[i] = sqrt (x[i]);
+    }
+
+  return (EXIT_SUCCESS);
+}
@@ -0,0 +1,566 @@
+/*****************************************************************************
+*                   Copyright (c) 2020-2021 Jack C. Lloyd.                   *
+*                            All rights reserved.                            *
+*****************************************************************************/
+
+#include "../include/context.h"
+#include "../include/evaluate.h"
+#include "../include/type.h"
+
+/*****************************************************************************
+*                              Standard Library                              *
+*****************************************************************************/
+
+#include <stdlib.h>
+
+/*****************************************************************************
+*                                 Data Types                                 *
+*****************************************************************************/
+
+#define NODE_UNKNOWN   (0x00) /**< "Of unknown value." */
+#define NODE_LITERAL   (0x01) /**< "A constant." */
+#define NODE_PARAMETER (0x02) /**< "A parameter." */
+#define NODE_OPERATOR  (0x03) /**< "An arithmetic operation." */
+#define NODE_ARGUMENT  (0x04) /**< "An argument, within a list thereof." */
+#define NODE_CALL      (0x05) /**< "A call." */
+
+#define CHUNK_LENGTH (256) /**< The nodes of a chunk. */
+
+/**
+ * A node data structure, forming a tree of an expression.
+ */
+struct node
+{
+  int kind;                 /**< The kind of the node, e.g. NODE_LITERAL. */
+  int operator;             /**< The operator of an operation. */
+  int type;                 /**< The type of a parameter, or an operation. */
+  struct range range;       /**< The range of a literal. */
+  size_t index;             /**< The index of a parameter. */
+  struct node *x;           /**< The first operand, or argument. */
+  struct node *y;           /**< The second operand. */
+  struct node *next;        /**< The next argument, within a list thereof. */
+  struct node *const *body; /**< The body of the procedure called. */
+};
+
+/**
+ * A chunk data structure, implemented as a linked list, holding nodes.
+ */
+struct chunk
+{
+  struct chunk *tail;               /**< The next (older) chunk. */
+  size_t size;                      /**< The nodes taken; not the length. */
+  struct node nodes[CHUNK_LENGTH];  /**< The nodes. */
+};
+
+/**
+ * An evaluator data structure, holding the nodes of a program.
+ */
+struct evaluator
+{
+  struct chunk *head; /**< The newest chunk. */
+};
+
+/**
+ * A state data structure, bounding an evaluation.
+ */
+struct state
+{
+  size_t steps; /**< The steps taken. */
+  size_t depth; /**< The calls nested. */
+};
+
+/**
+ * Allocate a node from an evaluator.
+ *
+ * @param evaluator The evaluator.
+ * @param kind      The kind of the node.
+ * @return          A zeroed node on success, otherwise a null-pointer.
+ */
+static struct node *
+evlnode (struct evaluator *evaluator, int kind)
+{
+  if (evaluator == NULL)
+    {
+      return (NULL);
+    }
+
+  if (evaluator->head == NULL || evaluator->head->size >= CHUNK_LENGTH)
+    {
+      struct chunk *chunk = (struct chunk *) malloc (sizeof (struct chunk));
+
+      if (chunk == NULL)
+        {
+          return (NULL);
+        }
+
+      chunk->tail = evaluator->head;
+      chunk->size = 0;
+
+      evaluator->head = chunk;
+    }
+
+  struct node *node = &(evaluator->head->nodes[evaluator->head->size++]);
+
+  node->kind     = kind;
+  node->operator = 0;
+  node->type     = KIND_NONE;
+  node->index    = 0;
+  node->x        = NULL;
+  node->y        = NULL;
+  node->next     = NULL;
+  node->body     = NULL;
+
+  rngnone (&node->range);
+
+  return (node);
+}
+
+/**
+ * Fit a constant to the declared type of its node, e.g. 260 is not of a
+ * natural8, such that "x + 250" of a natural8 x is left to run time, as is a
+ * call of an argument 300 for said x; that of an unknown type, e.g. of the
+ * result of a call, is as computed.
+ *
+ * @param type The type, e.g. KIND_NATURAL8.
+ * @param z    The range of said constant, of the kind of said type if fit.
+ * @return     Zero on success, otherwise EXIT_UNDEFINED.
+ */
+static int
+evlfit (int type, struct range *z)
+{
+  int const base = type & CLASS_MASK;
+
+  if (type == KIND_NONE)
+    {
+      return (z->kind != RANGE_NONE && z->minimum == z->maximum
+              ? EXIT_SUCCESS : EXIT_UNDEFINED);
+    }
+
+  if ((type & (CLASS_COMPOUND | CLASS_PROCEDURE | LANES_MASK))
+      || (base != CLASS_NATURAL && base != CLASS_INTEGER))
+    {
+      return (EXIT_UNDEFINED);
+    }
+
+  struct range bounds;
+
+  rngwidth (&bounds, base == CLASS_NATURAL ? RANGE_NATURAL : RANGE_INTEGER,
+            (type & WIDTH_MASK) >> WIDTH_SHIFT);
+
+  if (bounds.kind == RANGE_NONE || z->kind == RANGE_NONE
+      || z->minimum != z->maximum || z->minimum < bounds.minimum
+      || z->maximum > bounds.maximum)
+    {
+      return (EXIT_UNDEFINED);
+    }
+
+  z->kind = bounds.kind;
+
+  return (EXIT_SUCCESS);
+}
+
+/**
+ * Evaluate a node within a call.
+ *
+ * @param node      The node.
+ * @param arguments The values of the parameters of said call.
+ * @param count     The number thereof.
+ * @param state     The bounds of the evaluation.
+ * @param z         The range of its value.
+ * @return          See evlrun().
+ */
+static int
+evlstep (struct node const *node, struct range const *arguments,
+         size_t count, struct state *state, struct range *z)
+{
+  if (node == NULL)
+    {
+      return (EXIT_UNDEFINED);
+    }
+
+  if (++state->steps > EVALUATE_BUDGET)
+    {
+      return (EXIT_MAXIMISED);
+    }
+
+  switch (node->kind)
+    {
+    case NODE_LITERAL:
+      *z = node->range;
+      return (EXIT_SUCCESS);
+
+    case NODE_PARAMETER:
+      if (node->index >= count)
+        {
+          return (EXIT_UNDEFINED);
+        }
+
+      /* an argument not of the type of its parameter, e.g. -1 or 300 of a
+         natural8, is converted at run time, and is thus left thereto */
+
+      *z = arguments[node->index];
+      return (evlfit (node->type, z));
+
+    case NODE_OPERATOR:
+      break;
+
+    case NODE_CALL:
+      {
+        if (node->body == NULL || *node->body == NULL
+            || state->depth >= EVALUATE_DEPTH)
+          {
+            return (node->body != NULL && *node->body != NULL
+                    ? EXIT_MAXIMISED : EXIT_UNDEFINED);
+          }
+
+        struct range values[EVALUATE_ARGUMENTS];
+
+        size_t length = 0;
+
+        for (struct node const *it = node->x; it != NULL; it = it->next)
+          {
+            if (length >= EVALUATE_ARGUMENTS)
+              {
+                return (EXIT_UNDEFINED);
+              }
+
+            int const error = evlstep (it->x, arguments, count, state,
+                                       &values[length++]);
+
+            if (error != EXIT_SUCCESS)
+              {
+                return (error);
+              }
+          }
+
+        state->depth++;
+
+        int const error = evlstep (*node->body, values, length, state, z);
+
+        state->depth--;
+
+        return (error);
+      }
+
+    default:
+      return (EXIT_UNDEFINED);
+    }
+
+  struct range x, y;
+
+  int error = evlstep (node->x, arguments, count, state, &x);
+
+  if (error == EXIT_SUCCESS)
+    {
+      error = evlstep (node->y, arguments, count, state, &y);
+    }
+
+  if (error != EXIT_SUCCESS)
+    {
+      return (error);
+    }
+
+  switch (node->operator)
+    {
+    case '+':
+      error = rngadd (z, &x, &y);
+      break;
+
+    case '-':
+      error = rngsub (z, &x, &y);
+      break;
+
+    case '*':
+      error = rngmul (z, &x, &y);
+      break;
+
+    case '/':
+      error = rngdiv (z, &x, &y);
+      break;
+
+    case '%':
+      error = rngmod (z, &x, &y);
+      break;
+
+    default:
+      return (EXIT_UNDEFINED);
+    }
+
+  /* an operation which overflows, be it of its type alone, or divides by
+     zero, is left to run time */
+
+  if (error != EXIT_SUCCESS)
+    {
+      return (EXIT_UNDEFINED);
+    }
+
+  return (evlfit (node->type, z));
+}
+
+/*****************************************************************************
+*                                 Evaluators                                 *
+*****************************************************************************/
+
+/**
+ * Allocate an evaluator.
+ *
+ * @return An initialised evaluator on success, otherwise a null-pointer.
+ * @see    evlfree() and evlreset().
+ */
+struct evaluator *
+evlalloc (void)
+{
+  struct evaluator *evaluator = (struct evaluator *)
+                                malloc (sizeof (struct evaluator));
+
+  if (evaluator == NULL)
+    {
+      return (NULL);
+    }
+
+  evaluator->head = NULL;
+
+  return (evaluator);
+}
+
+/**
+ * Free an evaluator, along with every node thereof.
+ *
+ * @param evaluator The evaluator to free.
+ * @see             evlalloc() and evlreset().
+ */
+void
+evlfree (struct evaluator *evaluator)
+{
+  if (evaluator == NULL)
+    {
+      return;
+    }
+
+  evlreset (evaluator);
+  free (evaluator);
+}
+
+/**
+ * Reset an evaluator, freeing every node thereof.
+ *
+ * @param evaluator The evaluator to reset.
+ * @see             evlalloc() and evlfree().
+ */
+void
+evlreset (struct evaluator *evaluator)
+{
+  if (evaluator == NULL)
+    {
+      return;
+    }
+
+  while (evaluator->head != NULL)
+    {
+      struct chunk *tail = evaluator->head->tail;
+
+      free (evaluator->head);
+
+      evaluator->head = tail;
+    }
+}
+
+/*****************************************************************************
+*                                   Nodes                                    *
+*****************************************************************************/
+
+/**
+ * A node of unknown value, e.g. a real, or a variable.
+ *
+ * @param evaluator The evaluator.
+ * @return          See above.
+ */
+struct node *
+evlunknown (struct evaluator *evaluator)
+{
+  return (evlnode (evaluator, NODE_UNKNOWN));
+}
+
+/**
+ * A node of a literal, or any other constant.
+ *
+ * @param evaluator The evaluator.
+ * @param range     The range of said constant; if not constant, the node is
+ *                  unknown.
+ * @return          See above.
+ */
+struct node *
+evlliteral (struct evaluator *evaluator, struct range const *range)
+{
+  if (range == NULL || range->kind == RANGE_NONE
+      || range->minimum != range->maximum)
+    {
+      return (evlnode (evaluator, NODE_UNKNOWN));
+    }
+
+  struct node *node = evlnode (evaluator, NODE_LITERAL);
+
+  if (node != NULL)
+    {
+      node->range = *range;
+    }
+
+  return (node);
+}
+
+/**
+ * A node of a parameter of the procedure being parsed.
+ *
+ * @param evaluator The evaluator.
+ * @param index     The index of said parameter.
+ * @param type      The declared type of said parameter, e.g. KIND_NATURAL8.
+ * @return          See above.
+ */
+struct node *
+evlparameter (struct evaluator *evaluator, size_t index, int type)
+{
+  struct node *node = evlnode (evaluator, NODE_PARAMETER);
+
+  if (node != NULL)
+    {
+      node->index = index;
+      node->type  = type;
+    }
+
+  return (node);
+}
+
+/**
+ * A node of an arithmetic operation.
+ *
+ * @param evaluator The evaluator.
+ * @param operator  The operator, one of '+', '-', '*', '/', and '%'.
+ * @param x         The node of the first operand.
+ * @param y         The node of the second operand.
+ * @param type      The type of said operation, e.g. KIND_NATURAL8.
+ * @return          See above.
+ */
+struct node *
+evloperator (struct evaluator *evaluator, int operator, struct node *x,
+             struct node *y, int type)
+{
+  struct node *node = evlnode (evaluator, NODE_OPERATOR);
+
+  if (node != NULL)
+    {
+      node->operator = operator;
+      node->x        = x;
+      node->y        = y;
+      node->type     = type;
+    }
+
+  return (node);
+}
+
+/**
+ * Append an argument to a list thereof.
+ *
+ * @param evaluator The evaluator.
+ * @param list      The list, otherwise a null-pointer if empty.
+ * @param argument  The node of the argument.
+ * @return          Said list on success, otherwise a null-pointer.
+ * @see             evlcall().
+ */
+struct node *
+evlargument (struct evaluator *evaluator, struct node *list,
+             struct node *argument)
+{
+  struct node *node = evlnode (evaluator, NODE_ARGUMENT);
+
+  if (node == NULL)
+    {
+      return (NULL);
+    }
+
+  node->x = argument;
+
+  if (list == NULL)
+    {
+      return (node);
+    }
+
+  struct node *it = list;
+
+  while (it->next != NULL)
+    {
+      it = it->next;
+    }
+
+  it->next = node;
+
+  return (list);
+}
+
+/**
+ * A node of a call.
+ *
+ * @param evaluator The evaluator.
+ * @param body      A pointer to the body of the procedure called, which is
+ *                  read as the call is evaluated, as it may yet be parsed;
+ *                  otherwise a null-pointer, if not pure.
+ * @param list      The list of arguments, by evlargument().
+ * @return          See above.
+ */
+struct node *
+evlcall (struct evaluator *evaluator, struct node *const *body,
+         struct node *list)
+{
+  struct node *node = evlnode (evaluator, NODE_CALL);
+
+  if (node != NULL)
+    {
+      node->body = body;
+      node->x    = list;
+    }
+
+  return (node);
+}
+
+/**
+ * The number of arguments in a list thereof.
+ *
+ * @param list The list, by evlargument().
+ * @return     Said number.
+ */
+size_t
+evlcount (struct node const *list)
+{
+  size_t count = 0;
+
+  for ( ; list != NULL; list = list->next)
+    {
+      count++;
+    }
+
+  return (count);
+}
+
+/*****************************************************************************
+*                                 Evaluation                                 *
+*****************************************************************************/
+
+/**
+ * Evaluate a node, outside of any procedure, thus of no parameters.
+ *
+ * @param node  The node.
+ * @param range The range of its value, constant on success.
+ * @return      Zero on success, otherwise EXIT_UNDEFINED if unknown, or
+ *              EXIT_MAXIMISED if beyond EVALUATE_BUDGET or EVALUATE_DEPTH.
+ */
+int
+evlrun (struct node const *node, struct range *range)
+{
+  if (range == NULL)
+    {
+      return (EXIT_NULLPTR);
+    }
+
+  struct state state = { 0, 0 };
+
+  return (evlstep (node, NULL, 0, &state, range));
+}
@@ -0,0 +1,530 @@
+/*****************************************************************************
+*                   Copyright (c) 2020-2021 Jack C. Lloyd.                   *
+*                            All rights reserved.                            *
+*****************************************************************************/
+
+#include "../include/context.h"
+#include "../include/format.h"
+#include "../include/type.h"
+
+/*****************************************************************************
+*                              Standard Library                              *
+*****************************************************************************/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*****************************************************************************
+*                                 Data Types                                 *
+*****************************************************************************/
+
+#define FORMAT_END      (0x00) /**< "The end of the format." */
+#define FORMAT_ARGUMENT (0x09) /**< "An argument, not yet of its type." */
+
+#define DIGITS_LENGTH (24) /**< The most digits of a 64-bit number. */
+#define REAL_LENGTH   (32) /**< The longest shortest form of a real. */
+#define REAL_DIGITS   (17) /**< The digits which read back any real. */
+#define REAL_SMALL    (-5) /**< The least exponent of a real written plainly. */
+
+#define REAL32_DIGITS (9) /**< The digits which read back any real32. */
+#define REAL32_LARGE  (7) /**< The least exponent of a real32 not plain. */
+
+/**
+ * The digits of each number below one hundred, written two at a time.
+ */
+static char const pairs[] =
+  "00010203040506070809101112131415161718192021222324"
+  "25262728293031323334353637383940414243444546474849"
+  "50515253545556575859606162636465666768697071727374"
+  "75767778798081828384858687888990919293949596979899";
+
+/**
+ * A sink data structure, bounding the writes to a buffer.
+ */
+struct sink
+{
+  char *buffer;  /**< The buffer. */
+  size_t size;   /**< The size of said buffer, in bytes. */
+  size_t length; /**< The length written; not the size. */
+};
+
+/**
+ * Write bytes to a sink, as many as fit, leaving room for a null-terminator.
+ *
+ * @param sink The sink.
+ * @param data The bytes.
+ * @param size The number thereof.
+ */
+static void
+fmtput (struct sink *sink, char const *data, size_t size)
+{
+  if (sink->length + 1 < sink->size)
+    {
+      size_t const room = sink->size - sink->length - 1;
+
+      memcpy (sink->buffer + sink->length, data, size < room ? size : room);
+    }
+
+  sink->length += size;
+}
+
+/**
+ * Write the digits of a natural, two at a time.
+ *
+ * @param sink The sink.
+ * @param x    The natural.
+ */
+static void
+fmtnatural (struct sink *sink, natural64_t x)
+{
+  char digits[DIGITS_LENGTH];
+  char *it = digits + DIGITS_LENGTH;
+
+  while (x >= 100)
+    {
+      size_t const pair = (size_t) (x % 100) * 2;
+
+      x /= 100;
+
+      *--it = pairs[pair + 1];
+      *--it = pairs[pair];
+    }
+
+  if (x >= 10)
+    {
+      *--it = pairs[x * 2 + 1];
+      *--it = pairs[x * 2];
+    }
+  else
+    {
+      *--it = (char) ('0' + x);
+    }
+
+  fmtput (sink, it, (size_t) (digits + DIGITS_LENGTH - it));
+}
+
+/**
+ * Write the digits of an integer, preceded by its sign if negative.
+ *
+ * @param sink The sink.
+ * @param x    The integer.
+ */
+static void
+fmtinteger (struct sink *sink, integer64_t x)
+{
+  if (x < 0)
+    {
+      fmtput (sink, "-", 1);
+
+      /* negated as a natural, thus even the least integer */
+
+      fmtnatural (sink, (natural64_t) 0 - (natural64_t) x);
+
+      return;
+    }
+
+  fmtnatural (sink, (natural64_t) x);
+}
+
+/**
+ * Write a real in its shortest form: that of the fewest significant digits
+ * which reads back as said real, of its width; a real32 is read back by
+ * strtof(), and written plainly but for fewer digits than it holds exactly.
+ *
+ * @param sink   The sink.
+ * @param x      The real.
+ * @param narrow Whether said real is a real32, widened.
+ */
+static void
+fmtreal (struct sink *sink, real_t x, int narrow)
+{
+  char digits[REAL_LENGTH];
+
+  if (isnan (x))
+    {
+      fmtput (sink, "nan", 3);
+
+      return;
+    }
+
+  if (isinf (x))
+    {
+      fmtput (sink, x < 0 ? "-inf" : "inf", x < 0 ? 4 : 3);
+
+      return;
+    }
+
+  int const most  = narrow ? REAL32_DIGITS : REAL_DIGITS;
+  int const large = narrow ? REAL32_LARGE : REAL_DIGITS;
+
+  int precision = 0;
+  int length;
+
+  do
+    {
+      precision++;
+      length = snprintf (digits, REAL_LENGTH, "%.*e", precision - 1, x);
+    }
+  while (precision < most
+         && (narrow ? (real_t) strtof (digits, NULL) : strtod (digits, NULL))
+            != x);
+
+  /* a real of moderate magnitude is written plainly, e.g. 100 not 1e+02 */
+
+  int const exponent = (int) strtol (strchr (digits, 'e') + 1, NULL, 10);
+
+  if (exponent >= REAL_SMALL && exponent < large)
+    {
+      int const decimals = precision - 1 - exponent;
+
+      length = snprintf (digits, REAL_LENGTH, "%.*f",
+                         decimals > 0 ? decimals : 0, x);
+    }
+
+  fmtput (sink, digits, (size_t) length);
+}
+
+/**
+ * The operation writing an argument of a type.
+ *
+ * @param type The type.
+ * @return     Its kind, e.g. FORMAT_NATURAL, otherwise FORMAT_END if said
+ *             type is not written.
+ */
+static int
+fmtkind (int type)
+{
+  if (type & (CLASS_COMPOUND | CLASS_PROCEDURE | LANES_MASK))
+    {
+      return (FORMAT_END);
+    }
+
+  switch (type & CLASS_MASK)
+    {
+    case CLASS_BOOLEAN:
+      return (FORMAT_BOOLEAN);
+
+    case CLASS_NATURAL:
+      return (FORMAT_NATURAL);
+
+    case CLASS_INTEGER:
+      return (FORMAT_INTEGER);
+
+    case CLASS_REAL:
+      return (typsize (type) == 4 ? FORMAT_REAL32 : FORMAT_REAL);
+
+    case CLASS_CHARACTER:
+      return (FORMAT_CHARACTER);
+
+    case CLASS_STRING:
+      return (FORMAT_STRING);
+
+    default:
+      return (FORMAT_END);
+    }
+}
+
+/**
+ * Scan the next operation of a format: a part thereof, up to a brace, a
+ * brace of a pair thereof, or an argument.
+ *
+ * @param text     The format.
+ * @param offset   A pointer to the offset of said operation, then of the
+ *                 next.
+ * @param argument A pointer to the index of the next argument.
+ * @param z        The operation to fill in, FORMAT_END at the end.
+ * @return         Zero on success, otherwise EXIT_UNDEFINED for a brace
+ *                 unpaired.
+ */
+static int
+fmtscan (char const *text, size_t *offset, size_t *argument,
+         struct operation *z)
+{
+  char const *it = text + *offset;
+
+  z->kind     = FORMAT_LITERAL;
+  z->offset   = *offset;
+  z->length   = 1;
+  z->argument = 0;
+
+  if (it[0] == '\0')
+    {
+      z->kind   = FORMAT_END;
+      z->length = 0;
+    }
+  else if (it[0] == '{' && it[1] == '}')
+    {
+      z->kind     = FORMAT_ARGUMENT;
+      z->argument = (*argument)++;
+      *offset += 2;
+    }
+  else if ((it[0] == '{' && it[1] == '{') || (it[0] == '}' && it[1] == '}'))
+    {
+      *offset += 2; /* the first brace is copied, the second skipped */
+    }
+  else if (it[0] == '{' || it[0] == '}')
+    {
+      return (EXIT_UNDEFINED);
+    }
+  else
+    {
+      z->length = strcspn (it, "{}");
+      *offset += z->length;
+    }
+
+  return (EXIT_SUCCESS);
+}
+
+/**
+ * Run an operation of a format.
+ *
+ * @param sink      The sink.
+ * @param text      The format.
+ * @param operation The operation.
+ * @param arguments The arguments.
+ */
+static void
+fmtrun (struct sink *sink, char const *text,
+        struct operation const *operation, union argument const *arguments)
+{
+  if (operation->kind == FORMAT_LITERAL)
+    {
+      fmtput (sink, text + operation->offset, operation->length);
+
+      return;
+    }
+
+  union argument const *x = &arguments[operation->argument];
+
+  switch (operation->kind)
+    {
+    case FORMAT_BOOLEAN:
+      fmtput (sink, x->boolean ? "true" : "false", x->boolean ? 4 : 5);
+      break;
+
+    case FORMAT_NATURAL:
+      fmtnatural (sink, x->natural);
+      break;
+
+    case FORMAT_INTEGER:
+      fmtinteger (sink, x->integer);
+      break;
+
+    case FORMAT_REAL:
+      fmtreal (sink, x->real, 0);
+      break;
+
+    case FORMAT_REAL32:
+      fmtreal (sink, x->real, 1);
+      break;
+
+    case FORMAT_CHARACTER:
+      fmtput (sink, &x->character, 1);
+      break;
+
+    case FORMAT_STRING:
+      if (x->string != NULL)
+        {
+          fmtput (sink, x->string, strlen (x->string));
+        }
+      break;
+
+    default:
+      break;
+    }
+}
+
+/**
+ * Terminate the writes to a sink.
+ *
+ * @param sink The sink.
+ * @return     The length written, as by fmtwrite().
+ */
+static size_t
+fmtend (struct sink *sink)
+{
+  if (sink->size > 0)
+    {
+      size_t const end = sink->length < sink->size ? sink->length
+                                                   : sink->size - 1;
+
+      sink->buffer[end] = '\0';
+    }
+
+  return (sink->length);
+}
+
+/*****************************************************************************
+*                                  Formats                                   *
+*****************************************************************************/
+
+/**
+ * Compile a constant format, of the types of the arguments written thereby.
+ *
+ * @param z         The format to fill in, referring to the text thereof.
+ * @param text      The format, which must outlive said format.
+ * @param types     The types of the arguments, e.g. KIND_NATURAL.
+ * @param count     The number thereof.
+ * @return          Zero on success, EXIT_MAXIMISED if of too many
+ *                  operations, thus written by fmtprint(), otherwise
+ *                  EXIT_UNDEFINED if invalid, as for a stray brace, a type
+ *                  which is not written, or too few or too many arguments.
+ * @see             fmtwrite().
+ */
+int
+fmtcompile (struct format *z, char const *text, int const *types,
+            size_t count)
+{
+  if (z == NULL || text == NULL || (types == NULL && count > 0))
+    {
+      return (EXIT_NULLPTR);
+    }
+
+  z->text   = text;
+  z->length = 0;
+
+  size_t offset   = 0;
+  size_t argument = 0;
+
+  int error = EXIT_SUCCESS;
+
+  for (;;)
+    {
+      struct operation operation;
+
+      if (fmtscan (text, &offset, &argument, &operation) != EXIT_SUCCESS)
+        {
+          return (EXIT_UNDEFINED);
+        }
+
+      if (operation.kind == FORMAT_END)
+        {
+          break;
+        }
+
+      if (operation.kind == FORMAT_ARGUMENT)
+        {
+          operation.kind = operation.argument < count
+                           ? fmtkind (types[operation.argument]) : FORMAT_END;
+
+          if (operation.kind == FORMAT_END)
+            {
+              return (EXIT_UNDEFINED);
+            }
+        }
+
+      struct operation *last = z->length > 0
+                               ? &z->operations[z->length - 1] : NULL;
+
+      /* a part following another, as after a pair of braces, is joined */
+
+      if (last != NULL && last->kind == FORMAT_LITERAL
+          && operation.kind == FORMAT_LITERAL
+          && last->offset + last->length == operation.offset)
+        {
+          last->length += operation.length;
+        }
+      else if (z->length < FORMAT_LENGTH)
+        {
+          z->operations[z->length++] = operation;
+        }
+      else
+        {
+          error = EXIT_MAXIMISED; /* yet checked to its end */
+        }
+    }
+
+  return (argument != count ? EXIT_UNDEFINED : error);
+}
+
+/**
+ * Write a compiled format, as does snprintf(), thus null-terminated.
+ *
+ * @param format    The format, by fmtcompile().
+ * @param buffer    The buffer to write to.
+ * @param size      The size of said buffer, in bytes.
+ * @param arguments The arguments.
+ * @return          The length written, or which would have been if said
+ *                  buffer were large enough, without the null-terminator.
+ * @see             fmtcompile().
+ */
+size_t
+fmtwrite (struct format const *format, char *buffer, size_t size,
+          union argument const *arguments)
+{
+  struct sink sink = { buffer, buffer != NULL ? size : 0, 0 };
+
+  for (size_t i = 0; format != NULL && i < format->length; i++)
+    {
+      fmtrun (&sink, format->text, &format->operations[i], arguments);
+    }
+
+  return (fmtend (&sink));
+}
+
+/**
+ * Write a format, parsing it as it is written.
+ *
+ * @param buffer    The buffer to write to.
+ * @param size      The size of said buffer, in bytes.
+ * @param text      The format.
+ * @param types     The types of the arguments, e.g. KIND_NATURAL.
+ * @param arguments The arguments.
+ * @param count     The number thereof.
+ * @param length    A pointer to the length written, as by fmtwrite().
+ * @return          Zero on success, otherwise EXIT_UNDEFINED if invalid, as
+ *                  by fmtcompile().
+ */
+int
+fmtprint (char *buffer, size_t size, char const *text, int const *types,
+          union argument const *arguments, size_t count, size_t *length)
+{
+  if (text == NULL || length == NULL || (types == NULL && count > 0))
+    {
+      return (EXIT_NULLPTR);
+    }
+
+  struct sink sink = { buffer, buffer != NULL ? size : 0, 0 };
+
+  size_t offset   = 0;
+  size_t argument = 0;
+
+  int error = EXIT_SUCCESS;
+
+  for (;;)
+    {
+      struct operation operation;
+
+      if (fmtscan (text, &offset, &argument, &operation) != EXIT_SUCCESS)
+        {
+          error = EXIT_UNDEFINED;
+          break;
+        }
+
+      if (operation.kind == FORMAT_END)
+        {
+          break;
+        }
+
+      if (operation.kind == FORMAT_ARGUMENT)
+        {
+          operation.kind = operation.argument < count
+                           ? fmtkind (types[operation.argument]) : FORMAT_END;
+
+          if (operation.kind == FORMAT_END)
+            {
+              error = EXIT_UNDEFINED;
+              break;
+            }
+        }
+
+      fmtrun (&sink, text, &operation, arguments);
+    }
+
+  *length = fmtend (&sink);
+
+  return (error == EXIT_SUCCESS && argument != count ? EXIT_UNDEFINED
+                                                     : error);
+}
@@ -0,0 +1,139 @@
+/*****************************************************************************
+*                   Copyright (c) 2020-2021 Jack C. Lloyd.                   *
+*                            All rights reserved.                            *
+*****************************************************************************/
+
+#include "../include/frame.h"
+
+/*****************************************************************************
+*                              Standard Library                              *
+*****************************************************************************/
+
+#include <stdlib.h>
+
+/*****************************************************************************
+*                                 Data Types                                 *
+*****************************************************************************/
+
+/**
+ * An alignment data structure, the offset of whose value is the strictest
+ * alignment required by any value held by a frame.
+ */
+struct alignment
+{
+  char byte; /**< The padding before the value. */
+
+  union
+  {
+    long double real;    /**< The widest real. */
+    long long   integer; /**< The widest integer. */
+    void *      pointer; /**< The widest pointer. */
+  } value;
+};
+
+#define ALIGNMENT (offsetof (struct alignment, value))
+
+/**
+ * A block data structure, implemented as a linked list, preceding each heap
+ * allocation made by a frame.
+ */
+struct block
+{
+  struct block *tail; /**< The next block in the list. */
+  long double align;  /**< Aligns the allocation following the block. */
+};
+
+/*****************************************************************************
+*                                   Frames                                   *
+*****************************************************************************/
+
+/**
+ * Initialise a frame.
+ *
+ * @param frame The frame to initialise.
+ * @see         frmalloc() and frmfree().
+ */
+void
+frminit (struct frame *frame)
+{
+  if (frame == NULL)
+    {
+      return;
+    }
+
+  frame->heap = NULL;
+  frame->size = 0;
+}
+
+/**
+ * Allocate from a frame, falling back to the heap whenever the allocation
+ * exceeds FRAME_LIMIT or the remainder of the storage.
+ *
+ * @param frame The frame to allocate from.
+ * @param size  The size of the allocation, in bytes.
+ * @return      An aligned allocation on success, otherwise a null-pointer.
+ * @see         frminit() and frmfree().
+ */
+void *
+frmalloc (struct frame *frame, size_t size)
+{
+  if (frame == NULL)
+    {
+      return (NULL);
+    }
+
+  size_t const length = (size + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+
+  if (length >= size && length <= FRAME_LIMIT
+                     && length <= FRAME_LENGTH - frame->size)
+    {
+      void *data = &(frame->storage.bytes[frame->size]);
+
+      frame->size += length;
+
+      return (data);
+    }
+
+  if (size > (size_t)-1 - sizeof (struct block))
+    {
+      return (NULL);
+    }
+
+  struct block *block = (struct block *) malloc (sizeof (struct block) + size);
+
+  if (block == NULL)
+    {
+      return (NULL);
+    }
+
+  block->tail = frame->heap;
+  frame->heap = block;
+
+  return (block + 1);
+}
+
+/**
+ * Free a frame, releasing every allocation made from it.
+ *
+ * @param frame The frame to free.
+ * @see         frminit() and frmalloc().
+ */
+void
+frmfree (struct frame *frame)
+{
+  if (frame == NULL)
+    {
+      return;
+    }
+
+  while (frame->heap != NULL)
+    {
+      struct block *head = frame->heap;
+
+      frame->heap = head->tail;
+
+      free (head);
+    }
+
+  frame->size = 0;
+}
@@ -0,0 +1,367 @@
+/*****************************************************************************
+*                   Copyright (c) 2020-2021 Jack C. Lloyd.                   *
+*                            All rights reserved.                            *
+*****************************************************************************/
+
+#include "../include/context.h"
+#include "../include/generic.h"
+#include "../include/type.h"
+
+/*****************************************************************************
+*                              Standard Library                              *
+*****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/*****************************************************************************
+*                                 Data Types                                 *
+*****************************************************************************/
+
+#define KEY_LENGTH (256) /**< The longest key, as of a context. */
+
+#define INSTANCES_LENGTH (16) /**< The initial length of a table. */
+
+/**
+ * An instances data structure, containing instances, named by a context, and
+ * the instances of each code, named by another.
+ */
+struct instances
+{
+  struct context *names;       /**< The index of each instance. */
+  struct context *codes;       /**< The index of the instance of each code. */
+  struct instance **instances; /**< An array of instances. */
+  size_t size;                 /**< The size thereof; not the length. */
+  size_t length;               /**< The length thereof; not the size. */
+};
+
+/**
+ * Name an instance, or its code, by its procedure and its type arguments;
+ * its code is named by the sizes thereof, and by where each is passed.
+ *
+ * @param key       The name, of KEY_LENGTH characters.
+ * @param name      The name of the procedure.
+ * @param arguments The type arguments.
+ * @param count     The number thereof.
+ * @param code      Whether to name the code of the instance.
+ * @return          Zero on success, otherwise EXIT_OVERFLOW.
+ */
+static int
+genkey (char *key, char const *name, int const *arguments, size_t count,
+        int code)
+{
+  int length = snprintf (key, KEY_LENGTH, "%s<", name);
+
+  for (size_t i = 0; i < count && length >= 0 && length < KEY_LENGTH; i++)
+    {
+      int const type = arguments[i];
+
+      char const *separator = i + 1 < count ? "," : "";
+
+      if (!code)
+        {
+          length += snprintf (key + length, KEY_LENGTH - length, "%#x%s",
+                              (unsigned int) type, separator);
+
+          continue;
+        }
+
+      /* a string or an array is moved as a pointer, as is a general value */
+
+      size_t const size = (type & CLASS_COMPOUND)
+                          || (type & CLASS_MASK) == CLASS_STRING
+                          ? sizeof (void *) : typsize (type);
+
+      int const place = !(type & (CLASS_COMPOUND | CLASS_PROCEDURE))
+                        && ((type & LANES_MASK)
+                            || (type & CLASS_MASK) == CLASS_REAL) ? 'v' : 'g';
+
+      length += snprintf (key + length, KEY_LENGTH - length, "%c%zu%s",
+                          place, size, separator);
+    }
+
+  if (length >= 0 && length < KEY_LENGTH)
+    {
+      length += snprintf (key + length, KEY_LENGTH - length, ">");
+    }
+
+  return (length >= 0 && length < KEY_LENGTH ? EXIT_SUCCESS : EXIT_OVERFLOW);
+}
+
+/*****************************************************************************
+*                                 Deduction                                  *
+*****************************************************************************/
+
+/**
+ * The type of a type parameter.
+ *
+ * @param index The index of said type parameter.
+ * @return      Said type, of CLASS_GENERIC.
+ */
+int
+gentype (size_t index)
+{
+  return (CLASS_GENERIC | (int) index << WIDTH_SHIFT);
+}
+
+/**
+ * Deduce the type arguments of a call from the type of an argument passed to
+ * a parameter, e.g. T from "natural []" passed to "T []"; a type argument
+ * deduced from several arguments is the type to which each widens.
+ *
+ * @param parameter The type of the parameter.
+ * @param argument  The type of the argument, KIND_NONE if unknown.
+ * @param arguments The type arguments, KIND_NONE until deduced.
+ * @param count     The number thereof.
+ * @return          Zero on success, otherwise EXIT_UNDEFINED if said types
+ *                  conflict.
+ */
+int
+gendeduce (int parameter, int argument, int *arguments, size_t count)
+{
+  if (arguments == NULL)
+    {
+      return (EXIT_NULLPTR);
+    }
+
+  if ((parameter & CLASS_MASK) != CLASS_GENERIC || argument == KIND_NONE)
+    {
+      return (EXIT_SUCCESS); /* nothing to deduce */
+    }
+
+  size_t const index = (size_t) (parameter & WIDTH_MASK) >> WIDTH_SHIFT;
+
+  if (index >= count)
+    {
+      return (EXIT_UNDEFINED);
+    }
+
+  argument &= ~CLASS_ATOMIC; /* an atomic is passed as its value */
+
+  /* "T ()" is passed a procedure, whose result is of type T if known */
+
+  if ((parameter ^ argument) & CLASS_PROCEDURE)
+    {
+      return (EXIT_UNDEFINED);
+    }
+
+  if ((argument &= ~CLASS_PROCEDURE) == KIND_NONE)
+    {
+      return (EXIT_SUCCESS);
+    }
+
+  /* "T []" is passed an array, whose elements are of type T */
+
+  if (parameter & CLASS_COMPOUND)
+    {
+      if (!(argument & CLASS_COMPOUND))
+        {
+          return (EXIT_UNDEFINED);
+        }
+
+      argument &= ~CLASS_COMPOUND;
+    }
+
+  if (arguments[index] == KIND_NONE || arguments[index] == argument)
+    {
+      arguments[index] = argument;
+
+      return (EXIT_SUCCESS);
+    }
+
+  /* an element of an array is not converted, thus neither is its type */
+
+  if ((parameter | arguments[index] | argument) & CLASS_COMPOUND)
+    {
+      return (EXIT_UNDEFINED);
+    }
+
+  return (typwiden (arguments[index], argument, &arguments[index]));
+}
+
+/*****************************************************************************
+*                                 Instances                                  *
+*****************************************************************************/
+
+/**
+ * Allocate a table of instances.
+ *
+ * @return An initialised table on success, otherwise a null-pointer.
+ * @see    genfree() and genreset().
+ */
+struct instances *
+genalloc (void)
+{
+  struct instances *table = (struct instances *)
+                            malloc (sizeof (struct instances));
+
+  if (table == NULL)
+    {
+      return (NULL);
+    }
+
+  table->names     = ctxalloc ();
+  table->codes     = ctxalloc ();
+  table->instances = (struct instance **)
+                     malloc (INSTANCES_LENGTH * sizeof (struct instance *));
+  table->size      = 0;
+  table->length    = INSTANCES_LENGTH;
+
+  if (table->names == NULL || table->codes == NULL
+      || table->instances == NULL)
+    {
+      ctxfree (table->names);
+      ctxfree (table->codes);
+      free (table->instances);
+      free (table);
+
+      return (NULL);
+    }
+
+  return (table);
+}
+
+/**
+ * Free a table of instances.
+ *
+ * @param table The table to free.
+ * @see         genalloc() and genreset().
+ */
+void
+genfree (struct instances *table)
+{
+  if (table == NULL)
+    {
+      return;
+    }
+
+  for (size_t i = 0; i < table->size; i++)
+    {
+      free (table->instances[i]);
+    }
+
+  ctxfree (table->names);
+  ctxfree (table->codes);
+  free (table->instances);
+  free (table);
+}
+
+/**
+ * Reset a table of instances, forgetting every instance.
+ *
+ * @param table The table to reset.
+ * @return      Zero on success, otherwise an error code.
+ * @see         genalloc() and genfree().
+ */
+int
+genreset (struct instances *table)
+{
+  if (table == NULL)
+    {
+      return (EXIT_NULLPTR);
+    }
+
+  for (size_t i = 0; i < table->size; i++)
+    {
+      free (table->instances[i]);
+    }
+
+  ctxreset (table->names);
+  ctxreset (table->codes);
+
+  table->size = 0;
+
+  return (EXIT_SUCCESS);
+}
+
+/**
+ * Instantiate a generic procedure, unless already instantiated.
+ *
+ * @param table     The table of instances.
+ * @param name      The name of said procedure.
+ * @param arguments The type arguments, each known.
+ * @param count     The number thereof.
+ * @param opaque    Whether said procedure but moves values thereof, thus
+ *                  shares code between instances of equal sizes.
+ * @return          Said instance, valid until the table is reset or freed,
+ *                  on success, otherwise a null-pointer.
+ */
+struct instance const *
+geninstance (struct instances *table, char const *name, int const *arguments,
+             size_t count, int opaque)
+{
+  char key[KEY_LENGTH];
+  char code[KEY_LENGTH];
+
+  int index;
+
+  if (table == NULL || name == NULL || arguments == NULL
+      || count > GENERIC_LENGTH
+      || genkey (key, name, arguments, count, 0) != EXIT_SUCCESS
+      || genkey (code, name, arguments, count, opaque) != EXIT_SUCCESS)
+    {
+      return (NULL);
+    }
+
+  if (ctxsearch (table->names, key, &index) == EXIT_SUCCESS)
+    {
+      return (table->instances[index]);
+    }
+
+  if (table->size >= table->length)
+    {
+      size_t const length = table->length * 2;
+
+      struct instance **instances = (struct instance **)
+        realloc (table->instances, length * sizeof (struct instance *));
+
+      if (instances == NULL)
+        {
+          return (NULL);
+        }
+
+      table->instances = instances;
+      table->length    = length;
+    }
+
+  struct instance *instance = (struct instance *)
+                              calloc (1, sizeof (struct instance));
+
+  if (instance == NULL)
+    {
+      return (NULL);
+    }
+
+  for (size_t i = 0; i < count; i++)
+    {
+      instance->arguments[i] = arguments[i];
+    }
+
+  instance->count = count;
+  instance->index = table->size;
+  instance->code  = table->size;
+
+  int const shared = ctxsearch (table->codes, code, &index) == EXIT_SUCCESS;
+
+  if (ctxinsert (table->names, key, (int) table->size) != EXIT_SUCCESS)
+    {
+      free (instance);
+
+      return (NULL);
+    }
+
+  /* the first instance of a code is emitted, those thereafter share it */
+
+  if (shared)
+    {
+      instance->code = (size_t) index;
+    }
+  else
+    {
+      ctxinsert (table->codes, code, (int) table->size);
+    }
+
+  table->instances[table->size++] = instance;
+
+  return (instance);
+}
@@ -0,0 +1,425 @@
+/*****************************************************************************
+*                   Copyright (c) 2020-2021 Jack C. Lloyd.                   *
+*                            All rights reserved.                            *
+*****************************************************************************/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "../include/context.h"
+#include "../include/image.h"
+
+/*****************************************************************************
+*                              Standard Library                              *
+*****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*****************************************************************************
+*                                   POSIX                                    *
+*****************************************************************************/
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/*****************************************************************************
+*                                 Data Types                                 *
+*****************************************************************************/
+
+#define IMAGE_MAGIC  ("ZETAIMG") /**< Identifies a file as an image. */
+#define IMAGE_ALIGN  (16)        /**< The alignment of each allocation. */
+#define IMAGE_HEADER (64)        /**< The length of the header, in bytes. */
+#define IMAGE_NULL   ((size_t)-1) /**< The offset of no root. */
+
+/**
+ * A header data structure, preceding the data of an image, in memory and
+ * on file alike.
+ */
+struct header
+{
+  char magic[8];         /**< The magic string, IMAGE_MAGIC. */
+  unsigned long version; /**< The version of the format, __IMAGE__. */
+  size_t length;         /**< The capacity of the data; not the size. */
+  size_t size;           /**< The size of the data; not the length. */
+  size_t root;           /**< The offset of the root, or IMAGE_NULL. */
+};
+
+typedef char header_fits[sizeof (struct header) <= IMAGE_HEADER ? 1 : -1];
+
+/**
+ * An image data structure, containing a header followed by its data.
+ */
+struct image
+{
+  struct header *header; /**< The header, followed by the data. */
+  unsigned char *data;   /**< The data, IMAGE_HEADER bytes after the header. */
+  size_t mapping;        /**< The length mapped by imgload(), otherwise 0. */
+};
+
+/*****************************************************************************
+*                                   Images                                   *
+*****************************************************************************/
+
+/**
+ * Allocate an image.
+ *
+ * @param length The capacity of the image, in bytes.
+ * @return       An initialised image on success, otherwise a null-pointer.
+ * @see          imgload() and imgfree().
+ */
+struct image *
+imgalloc (size_t length)
+{
+  if (length > (size_t)-1 - IMAGE_HEADER)
+    {
+      return (NULL);
+    }
+
+  struct image *image = (struct image *) malloc (sizeof (struct image));
+
+  if (image == NULL)
+    {
+      return (NULL);
+    }
+
+  image->header = (struct header *) calloc (1, IMAGE_HEADER + length);
+
+  if (image->header == NULL)
+    {
+      free (image);
+
+      return (NULL);
+    }
+
+  memcpy (image->header->magic, IMAGE_MAGIC, sizeof (IMAGE_MAGIC));
+
+  image->header->version = __IMAGE__;
+  image->header->length  = length;
+  image->header->size    = 0;
+  image->header->root    = IMAGE_NULL;
+
+  image->data    = (unsigned char *) image->header + IMAGE_HEADER;
+  image->mapping = 0;
+
+  return (image);
+}
+
+/**
+ * Free an image, unmapping it if it was loaded.
+ *
+ * @param image The image to free.
+ * @see         imgalloc() and imgload().
+ */
+void
+imgfree (struct image *image)
+{
+  if (image == NULL)
+    {
+      return;
+    }
+
+  if (image->mapping != 0)
+    {
+      munmap (image->header, image->mapping);
+    }
+  else
+    {
+      free (image->header);
+    }
+
+  free (image);
+}
+
+/*****************************************************************************
+*                                Take and Root                               *
+*****************************************************************************/
+
+/**
+ * Take an aligned, zeroed allocation from an image.
+ *
+ * @param image The image to take from.
+ * @param size  The size of the allocation, in bytes.
+ * @return      The allocation on success, otherwise a null-pointer; always a
+ *              null-pointer for a loaded image, whose capacity is its size.
+ * @see         imgoffset() and imgpointer().
+ */
+void *
+imgtake (struct image *image, size_t size)
+{
+  if (image == NULL)
+    {
+      return (NULL);
+    }
+
+  size_t const remainder = image->header->length - image->header->size;
+
+  if (size > remainder - remainder % IMAGE_ALIGN)
+    {
+      return (NULL);
+    }
+
+  void *data = image->data + image->header->size;
+
+  image->header->size += (size + IMAGE_ALIGN - 1) / IMAGE_ALIGN * IMAGE_ALIGN;
+
+  return (data);
+}
+
+/**
+ * The offset of a pointer into an image.
+ *
+ * @param image   The image pointed into.
+ * @param pointer The pointer, taken from said image.
+ * @return        The offset of said pointer, to be stored within the image.
+ * @see           imgtake() and imgpointer().
+ */
+size_t
+imgoffset (struct image const *image, void const *pointer)
+{
+  if (image == NULL || pointer == NULL)
+    {
+      return (IMAGE_NULL);
+    }
+
+  return ((size_t)((unsigned char const *) pointer - image->data));
+}
+
+/**
+ * The pointer at an offset into an image.
+ *
+ * @param image  The image pointed into.
+ * @param offset The offset, from imgoffset().
+ * @return       The pointer on success, otherwise a null-pointer.
+ * @see          imgtake() and imgoffset().
+ */
+void *
+imgpointer (struct image const *image, size_t offset)
+{
+  if (image == NULL || offset >= image->header->size)
+    {
+      return (NULL);
+    }
+
+  return (image->data + offset);
+}
+
+/**
+ * The pointer at an offset into an image, of a span of bytes lying wholly
+ * within said image, such that said span may be read without further checks.
+ *
+ * @param image  The image pointed into.
+ * @param offset The offset, from imgoffset().
+ * @param size   The size of said span, in bytes.
+ * @return       The pointer on success, otherwise a null-pointer.
+ * @see          imgpointer().
+ */
+void *
+imgspan (struct image const *image, size_t offset, size_t size)
+{
+  if (image == NULL || offset >= image->header->size
+      || size > image->header->size - offset)
+    {
+      return (NULL);
+    }
+
+  return (image->data + offset);
+}
+
+/**
+ * Mark the root of an image: the module state from which every other value
+ * in said image is reached.
+ *
+ * @param image The image to mark.
+ * @param root  The root, taken from said image.
+ * @return      Zero on success, otherwise an error code.
+ * @see         imgroot().
+ */
+int
+imgmark (struct image *image, void const *root)
+{
+  if (image == NULL || root == NULL)
+    {
+      return (EXIT_NULLPTR);
+    }
+
+  size_t const offset = imgoffset (image, root);
+
+  if (offset >= image->header->size)
+    {
+      return (EXIT_UNDEFINED);
+    }
+
+  image->header->root = offset;
+
+  return (EXIT_SUCCESS);
+}
+
+/**
+ * The root of an image.
+ *
+ * @param image The image whose root to find.
+ * @return      The root on success, otherwise a null-pointer.
+ * @see         imgmark().
+ */
+void *
+imgroot (struct image const *image)
+{
+  if (image == NULL)
+    {
+      return (NULL);
+    }
+
+  return (imgpointer (image, image->header->root));
+}
+
+/*****************************************************************************
+*                               Save and Load                                *
+*****************************************************************************/
+
+/**
+ * Save an image to a file.
+ *
+ * @param image The image to save.
+ * @param path  The path of said file.
+ * @return      Zero on success, otherwise an error code.
+ * @see         imgload().
+ */
+int
+imgsave (struct image const *image, char const *path)
+{
+  if (image == NULL || path == NULL)
+    {
+      return (EXIT_NULLPTR);
+    }
+
+  FILE *file = fopen (path, "wb");
+
+  if (file == NULL)
+    {
+      return (EXIT_FILE);
+    }
+
+  size_t const length = IMAGE_HEADER + image->header->size;
+
+  if (fwrite (image->header, 1, length, file) != length)
+    {
+      fclose (file);
+      remove (path);
+
+      return (EXIT_FILE);
+    }
+
+  if (fclose (file) != 0)
+    {
+      remove (path);
+
+      return (EXIT_FILE);
+    }
+
+  return (EXIT_SUCCESS);
+}
+
+/**
+ * Load an image from a file, mapping it privately into memory, such that
+ * writes to the image never reach said file.
+ *
+ * @param path The path of the file.
+ * @return     An initialised image on success, otherwise a null-pointer.
+ * @see        imgsave() and imgfree().
+ */
+struct image *
+imgload (char const *path)
+{
+  if (path == NULL)
+    {
+      return (NULL);
+    }
+
+  int const file = open (path, O_RDONLY);
+
+  if (file < 0)
+    {
+      return (NULL);
+    }
+
+  struct stat status;
+
+  if (fstat (file, &status) != 0 || status.st_size < IMAGE_HEADER)
+    {
+      close (file);
+
+      return (NULL);
+    }
+
+  size_t const mapping = (size_t) status.st_size;
+
+  void *map = mmap (NULL, mapping, PROT_READ | PROT_WRITE, MAP_PRIVATE, file, 0);
+
+  close (file);
+
+  if (map == MAP_FAILED)
+    {
+      return (NULL);
+    }
+
+  struct header *header = (struct header *) map;
+
+  if (memcmp (header->magic, IMAGE_MAGIC, sizeof (IMAGE_MAGIC)) != 0
+      || header->version != __IMAGE__
+      || header->size != mapping - IMAGE_HEADER
+      || (header->root != IMAGE_NULL && header->root >= header->size))
+    {
+      munmap (map, mapping);
+
+      return (NULL);
+    }
+
+  struct image *image = (struct image *) malloc (sizeof (struct image));
+
+  if (image == NULL)
+    {
+      munmap (map, mapping);
+
+      return (NULL);
+    }
+
+  header->length = header->size;
+
+  image->header  = header;
+  image->data    = (unsigned char *) map + IMAGE_HEADER;
+  image->mapping = mapping;
+
+  return (image);
+}
+
+/**
+ * Execute an image, remapping a loaded image read-only and executable, such
+ * that it may hold machine code; no further writes to it are permitted.
+ *
+ * @param image The image to execute.
+ * @return      Zero on success, otherwise an error code.
+ * @see         imgload().
+ */
+int
+imgexec (struct image *image)
+{
+  if (image == NULL)
+    {
+      return (EXIT_NULLPTR);
+    }
+
+  if (image->mapping == 0)
+    {
+      return (EXIT_UNDEFINED);
+    }
+
+  if (mprotect (image->header, image->mapping, PROT_READ | PROT_EXEC) != 0)
+    {
+      return (EXIT_FILE);
+    }
+
+  return (EXIT_SUCCESS);
+}
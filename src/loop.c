@@ -0,0 +1,269 @@
+/*****************************************************************************
+*                   Copyright (c) 2020-2021 Jack C. Lloyd.                   *
+*                            All rights reserved.                            *
+*****************************************************************************/
+
+#include "../include/context.h"
+#include "../include/loop.h"
+
+/*****************************************************************************
+*                              Standard Library                              *
+*****************************************************************************/
+
+#include <stdlib.h>
+
+/*****************************************************************************
+*                                 Data Types                                 *
+*****************************************************************************/
+
+/**
+ * Whether a range is of a single, known value.
+ *
+ * @param x The range.
+ * @return  Non-zero if so, otherwise zero.
+ */
+static int
+looconstant (struct range const *x)
+{
+  return (x != NULL && x->kind != RANGE_NONE && x->minimum == x->maximum);
+}
+
+/*****************************************************************************
+*                                   Loops                                    *
+*****************************************************************************/
+
+/**
+ * Recognise a counted loop from the ranges of its variable's initial value,
+ * its step, and its limit, each of 32 bits; the initial value and the step
+ * must be constant, whereas the limit may be known only at run time.
+ *
+ * @param z       The induction to fill in.
+ * @param compare The comparison, e.g. LOOP_LESS.
+ * @param initial The range of the initial value.
+ * @param step    The range of the step.
+ * @param limit   The range of the limit.
+ * @return        Zero on success, otherwise EXIT_UNDEFINED.
+ * @see           lootrips().
+ */
+int
+looinduction (struct induction *z, int compare, struct range const *initial,
+              struct range const *step, struct range const *limit)
+{
+  if (z == NULL)
+    {
+      return (EXIT_NULLPTR);
+    }
+
+  if (compare < LOOP_LESS || compare > LOOP_NOT_EQUAL
+      || !looconstant (initial) || !looconstant (step)
+      || limit == NULL || limit->kind == RANGE_NONE || step->minimum == 0
+      || (initial->kind | step->kind | limit->kind) & RANGE_WIDE)
+    {
+      return (EXIT_UNDEFINED);
+    }
+
+  z->kind     = initial->kind;
+  z->compare  = compare;
+  z->initial  = initial->minimum;
+  z->step     = step->minimum;
+  z->limit    = limit->minimum;
+  z->greatest = limit->maximum;
+
+  return (EXIT_SUCCESS);
+}
+
+/**
+ * The trips of a counted loop, i.e. the times its body is run.
+ *
+ * @param x     The induction.
+ * @param trips A pointer to said trips, LOOP_UNKNOWN if its limit is known
+ *              only at run time, unless none.
+ * @return      Zero on success, EXIT_OVERFLOW if its variable would, or of a
+ *              limit known only at run time may, step beyond its kind,
+ *              otherwise EXIT_UNDEFINED if it may never end, as for a step
+ *              away from its limit.
+ * @see         loofinal().
+ */
+int
+lootrips (struct induction const *x, long long *trips)
+{
+  if (x == NULL || trips == NULL)
+    {
+      return (EXIT_NULLPTR);
+    }
+
+  /* a limit known only at run time is as far as its range allows, i.e. the
+     greatest of an increasing variable, or the least of a decreasing one;
+     if said loop never runs, nor does it of any other limit */
+
+  if (x->limit != x->greatest)
+    {
+      struct induction extreme = *x;
+
+      if (x->compare == LOOP_NOT_EQUAL) /* may never reach its limit */
+        {
+          *trips = LOOP_UNKNOWN;
+
+          return (EXIT_UNDEFINED);
+        }
+
+      if (x->compare == LOOP_LESS || x->compare == LOOP_LESS_EQUAL)
+        {
+          extreme.limit = x->greatest;
+        }
+      else
+        {
+          extreme.greatest = x->limit;
+        }
+
+      int const error = lootrips (&extreme, trips);
+
+      *trips = *trips == 0 ? 0 : LOOP_UNKNOWN;
+
+      return (error);
+    }
+
+  /* the bounds are those of 32 bits, thus none below overflows 64 bits */
+
+  long long const minimum = x->kind == RANGE_NATURAL ? (long long) NATURAL_MIN
+                                                     : (long long) INTEGER_MIN;
+  long long const maximum = x->kind == RANGE_NATURAL ? (long long) NATURAL_MAX
+                                                     : (long long) INTEGER_MAX;
+
+  long long const span   = llabs (x->limit - x->initial);
+  long long const stride = llabs (x->step);
+
+  int up = 0; /* whether the variable must increase towards its limit */
+
+  switch (x->compare)
+    {
+    case LOOP_LESS:
+      *trips = x->initial < x->limit ? (span + stride - 1) / stride : 0;
+      up = 1;
+      break;
+
+    case LOOP_LESS_EQUAL:
+      *trips = x->initial <= x->limit ? span / stride + 1 : 0;
+      up = 1;
+      break;
+
+    case LOOP_GREATER:
+      *trips = x->initial > x->limit ? (span + stride - 1) / stride : 0;
+      break;
+
+    case LOOP_GREATER_EQUAL:
+      *trips = x->initial >= x->limit ? span / stride + 1 : 0;
+      break;
+
+    case LOOP_NOT_EQUAL: /* ends only upon reaching its limit exactly */
+      if (span % stride != 0)
+        {
+          *trips = LOOP_UNKNOWN;
+
+          return (EXIT_UNDEFINED);
+        }
+
+      *trips = span / stride;
+      up = x->initial < x->limit;
+      break;
+
+    default:
+      return (EXIT_UNDEFINED);
+    }
+
+  if (*trips == 0)
+    {
+      return (EXIT_SUCCESS);
+    }
+
+  if (up != (x->step > 0))
+    {
+      *trips = LOOP_UNKNOWN;
+
+      return (EXIT_UNDEFINED);
+    }
+
+  /* the final step, after the last trip, must yet be of the variable's kind */
+
+  long long const final = loofinal (x, *trips);
+
+  if (final < minimum || final > maximum)
+    {
+      return (EXIT_OVERFLOW);
+    }
+
+  return (EXIT_SUCCESS);
+}
+
+/**
+ * The value of the variable of a counted loop after said loop, such that a
+ * use thereof needs neither the variable nor the loop.
+ *
+ * @param x     The induction.
+ * @param trips The trips, as by lootrips().
+ * @return      Said value.
+ */
+long long
+loofinal (struct induction const *x, long long trips)
+{
+  if (x == NULL)
+    {
+      return (0);
+    }
+
+  return (x->initial + trips * x->step);
+}
+
+/**
+ * Plan the unrolling of a loop: fully, if its trips are known and few, and
+ * its body thus copied is within LOOP_BUDGET operations; otherwise partially,
+ * by the greatest power of two within LOOP_UNROLL and said budget.
+ *
+ * @param z     The unrolling to fill in.
+ * @param trips The trips, otherwise LOOP_UNKNOWN.
+ * @param cost  The operations of the body, at least one.
+ * @return      Zero on success, otherwise an error code.
+ * @see         lootrips().
+ */
+int
+looplan (struct unroll *z, long long trips, size_t cost)
+{
+  if (z == NULL)
+    {
+      return (EXIT_NULLPTR);
+    }
+
+  if (cost == 0)
+    {
+      cost = 1;
+    }
+
+  z->trips = trips;
+
+  if (trips >= 0 && trips <= LOOP_FULL
+      && (size_t) trips * cost <= LOOP_BUDGET)
+    {
+      z->factor    = trips;
+      z->remainder = 0;
+
+      return (EXIT_SUCCESS);
+    }
+
+  z->factor = LOOP_UNROLL;
+
+  while (z->factor > 1 && (size_t) z->factor * cost > LOOP_BUDGET)
+    {
+      z->factor /= 2;
+    }
+
+  /* a loop of fewer trips than the factor gains nothing from unrolling */
+
+  if (trips >= 0 && trips < z->factor)
+    {
+      z->factor = 1;
+    }
+
+  z->remainder = trips >= 0 ? trips % z->factor : LOOP_UNKNOWN;
+
+  return (EXIT_SUCCESS);
+}
@@ -0,0 +1,1176 @@
+/*****************************************************************************
+*                   Copyright (c) 2020-2021 Jack C. Lloyd.                   *
+*                            All rights reserved.                            *
+*****************************************************************************/
+
+#include "../include/arithmetic.h"
+#include "../include/number.h"
+#include "../include/options.h"
+
+/*****************************************************************************
+*                              Standard Library                              *
+*****************************************************************************/
+
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/*****************************************************************************
+*                                 Data Types                                 *
+*****************************************************************************/
+
+#define LIMB_BITS (32)                      /**< The bits in a limb. */
+#define LIMB_BASE ((uint64_t) 1 << LIMB_BITS) /**< The base of the limbs. */
+
+/**
+ * A bignum data structure, holding the sign and magnitude of a number which
+ * does not fit in a machine word.
+ */
+struct bignum
+{
+  size_t length;     /**< The number of limbs, without leading zeros. */
+  int negative;      /**< Whether the number is negative. */
+  uint32_t limbs[];  /**< The limbs, the least significant first. */
+};
+
+/**
+ * A view data structure, presenting either representation of a number as a
+ * sign and magnitude.
+ */
+struct view
+{
+  int negative;          /**< Whether the number is negative. */
+  size_t length;         /**< The number of limbs. */
+  uint32_t const *limbs; /**< The limbs, the least significant first. */
+  uint32_t buffer[2];    /**< The limbs of a small number. */
+};
+
+/*****************************************************************************
+*                                   Smalls                                   *
+*****************************************************************************/
+
+/**
+ * Add two machine words.
+ */
+static inline int
+smladd (long long x, long long y, long long *z)
+{
+#ifdef ARITHMETIC_BUILTIN
+  return (ARITHMETIC_UNLIKELY (__builtin_add_overflow (x, y, z))
+          ? EXIT_OVERFLOW : EXIT_SUCCESS);
+#else
+  if (ARITHMETIC_UNLIKELY (y > 0 ? x > LLONG_MAX - y : x < LLONG_MIN - y))
+    {
+      return (EXIT_OVERFLOW);
+    }
+
+  *z = x + y;
+
+  return (EXIT_SUCCESS);
+#endif /* ARITHMETIC_BUILTIN */
+}
+
+/**
+ * Subtract two machine words.
+ */
+static inline int
+smlsub (long long x, long long y, long long *z)
+{
+#ifdef ARITHMETIC_BUILTIN
+  return (ARITHMETIC_UNLIKELY (__builtin_sub_overflow (x, y, z))
+          ? EXIT_OVERFLOW : EXIT_SUCCESS);
+#else
+  if (ARITHMETIC_UNLIKELY (y < 0 ? x > LLONG_MAX + y : x < LLONG_MIN + y))
+    {
+      return (EXIT_OVERFLOW);
+    }
+
+  *z = x - y;
+
+  return (EXIT_SUCCESS);
+#endif /* ARITHMETIC_BUILTIN */
+}
+
+/**
+ * Multiply two machine words.
+ */
+static inline int
+smlmul (long long x, long long y, long long *z)
+{
+#ifdef ARITHMETIC_BUILTIN
+  return (ARITHMETIC_UNLIKELY (__builtin_mul_overflow (x, y, z))
+          ? EXIT_OVERFLOW : EXIT_SUCCESS);
+#else
+  if (ARITHMETIC_UNLIKELY (x > 0 ? (y > 0 ? x > LLONG_MAX / y
+                                          : y < LLONG_MIN / x)
+                                 : (y > 0 ? x < LLONG_MIN / y
+                                          : x != 0 && y < LLONG_MAX / x)))
+    {
+      return (EXIT_OVERFLOW);
+    }
+
+  *z = x * y;
+
+  return (EXIT_SUCCESS);
+#endif /* ARITHMETIC_BUILTIN */
+}
+
+/*****************************************************************************
+*                                 Magnitudes                                 *
+*****************************************************************************/
+
+/**
+ * Compare two magnitudes, without leading zeros.
+ */
+static int
+magcmp (uint32_t const *a, size_t al, uint32_t const *b, size_t bl)
+{
+  if (al != bl)
+    {
+      return (al < bl ? -1 : 1);
+    }
+
+  for (size_t i = al; i-- > 0; )
+    {
+      if (a[i] != b[i])
+        {
+          return (a[i] < b[i] ? -1 : 1);
+        }
+    }
+
+  return (0);
+}
+
+/**
+ * Add two magnitudes, into max(al, bl) + 1 limbs of z.
+ */
+static void
+magadd (uint32_t *z, uint32_t const *a, size_t al, uint32_t const *b, size_t bl)
+{
+  if (al < bl)
+    {
+      uint32_t const *t = a; a = b; b = t;
+      size_t const tl = al; al = bl; bl = tl;
+    }
+
+  uint64_t carry = 0;
+
+  for (size_t i = 0; i < al; i++)
+    {
+      carry += (uint64_t) a[i] + (i < bl ? b[i] : 0);
+      z[i]   = (uint32_t) carry;
+      carry >>= LIMB_BITS;
+    }
+
+  z[al] = (uint32_t) carry;
+}
+
+/**
+ * Subtract two magnitudes, where a is no less than b, into al limbs of z.
+ */
+static void
+magsub (uint32_t *z, uint32_t const *a, size_t al, uint32_t const *b, size_t bl)
+{
+  int64_t borrow = 0;
+
+  for (size_t i = 0; i < al; i++)
+    {
+      int64_t const t = (int64_t) a[i] - (i < bl ? b[i] : 0) - borrow;
+
+      z[i]   = (uint32_t) t;
+      borrow = t < 0;
+    }
+}
+
+/**
+ * Add a magnitude into another of zl limbs, which does not overflow.
+ */
+static void
+magaccumulate (uint32_t *z, size_t zl, uint32_t const *a, size_t al)
+{
+  uint64_t carry = 0;
+  size_t i;
+
+  for (i = 0; i < al; i++)
+    {
+      carry += (uint64_t) z[i] + a[i];
+      z[i]   = (uint32_t) carry;
+      carry >>= LIMB_BITS;
+    }
+
+  for ( ; carry != 0 && i < zl; i++)
+    {
+      carry += z[i];
+      z[i]   = (uint32_t) carry;
+      carry >>= LIMB_BITS;
+    }
+}
+
+/**
+ * Subtract a magnitude from another of zl limbs, which is no less.
+ */
+static void
+magdeplete (uint32_t *z, size_t zl, uint32_t const *a, size_t al)
+{
+  int64_t borrow = 0;
+  size_t i;
+
+  for (i = 0; i < al; i++)
+    {
+      int64_t const t = (int64_t) z[i] - a[i] - borrow;
+
+      z[i]   = (uint32_t) t;
+      borrow = t < 0;
+    }
+
+  for ( ; borrow != 0 && i < zl; i++)
+    {
+      borrow = z[i] == 0;
+      z[i]--;
+    }
+}
+
+/**
+ * Multiply two magnitudes, by schoolbook, into al + bl limbs of z.
+ */
+static void
+magschool (uint32_t *z, uint32_t const *a, size_t al,
+           uint32_t const *b, size_t bl)
+{
+  memset (z, 0, (al + bl) * sizeof (uint32_t));
+
+  for (size_t i = 0; i < al; i++)
+    {
+      uint64_t carry = 0;
+
+      for (size_t j = 0; j < bl; j++)
+        {
+          carry   += (uint64_t) a[i] * b[j] + z[i + j];
+          z[i + j] = (uint32_t) carry;
+          carry  >>= LIMB_BITS;
+        }
+
+      z[i + bl] = (uint32_t) carry;
+    }
+}
+
+/**
+ * Multiply two magnitudes, by Karatsuba above NUMBER_KARATSUBA limbs, into
+ * al + bl limbs of z.
+ */
+static int
+magmul (uint32_t *z, uint32_t const *a, size_t al, uint32_t const *b, size_t bl)
+{
+  if (al < NUMBER_KARATSUBA || bl < NUMBER_KARATSUBA)
+    {
+      magschool (z, a, al, b, bl);
+
+      return (EXIT_SUCCESS);
+    }
+
+  if (al < bl)
+    {
+      uint32_t const *t = a; a = b; b = t;
+      size_t const tl = al; al = bl; bl = tl;
+    }
+
+  size_t const h = al / 2;
+
+  memset (z, 0, (al + bl) * sizeof (uint32_t));
+
+  if (bl <= h) /* unbalanced: split the longer alone, z = a0 b + a1 b B^h */
+    {
+      uint32_t *t = (uint32_t *) malloc ((al - h + bl) * sizeof (uint32_t));
+
+      if (t == NULL)
+        {
+          return (EXIT_MALLOC);
+        }
+
+      int error = magmul (t, a, h, b, bl);
+
+      if (error == EXIT_SUCCESS)
+        {
+          magaccumulate (z, al + bl, t, h + bl);
+
+          error = magmul (t, a + h, al - h, b, bl);
+        }
+
+      if (error == EXIT_SUCCESS)
+        {
+          magaccumulate (z + h, al + bl - h, t, al - h + bl);
+        }
+
+      free (t);
+
+      return (error);
+    }
+
+  /* z = z0 + ((a0 + a1) (b0 + b1) - z0 - z2) B^h + z2 B^2h */
+
+  size_t const a1l = al - h;
+  size_t const b1l = bl - h;
+  size_t const sal = a1l + 1;
+  size_t const sbl = (b1l > h ? b1l : h) + 1;
+  size_t pl        = sal + sbl;
+
+  uint32_t *sa = (uint32_t *) malloc ((sal + sbl + pl + 2 * h + a1l + b1l)
+                                      * sizeof (uint32_t));
+
+  if (sa == NULL)
+    {
+      return (EXIT_MALLOC);
+    }
+
+  uint32_t *sb = sa + sal;
+  uint32_t *p  = sb + sbl;
+  uint32_t *z0 = p + pl;
+  uint32_t *z2 = z0 + 2 * h;
+
+  magadd (sa, a, h, a + h, a1l);
+  magadd (sb, b, h, b + h, b1l);
+
+  int error = magmul (z0, a, h, b, h);
+
+  if (error == EXIT_SUCCESS)
+    {
+      error = magmul (z2, a + h, a1l, b + h, b1l);
+    }
+
+  if (error == EXIT_SUCCESS)
+    {
+      error = magmul (p, sa, sal, sb, sbl);
+    }
+
+  if (error == EXIT_SUCCESS)
+    {
+      magdeplete (p, pl, z0, 2 * h);
+      magdeplete (p, pl, z2, a1l + b1l);
+
+      while (pl > 0 && p[pl - 1] == 0)
+        {
+          pl--;
+        }
+
+      memcpy (z, z0, 2 * h * sizeof (uint32_t));
+      memcpy (z + 2 * h, z2, (a1l + b1l) * sizeof (uint32_t));
+
+      magaccumulate (z + h, al + bl - h, p, pl);
+    }
+
+  free (sa);
+
+  return (error);
+}
+
+/**
+ * The number of leading zero bits of a (non-zero) limb.
+ */
+static int
+magclz (uint32_t x)
+{
+  int n = 0;
+
+  while ((x & 0x80000000u) == 0)
+    {
+      x <<= 1;
+      n++;
+    }
+
+  return (n);
+}
+
+/**
+ * The high limb of two adjacent limbs, shifted left by s bits.
+ */
+static uint32_t
+magfunnel (uint32_t high, uint32_t low, int s)
+{
+  return (s == 0 ? high : (high << s) | (low >> (LIMB_BITS - s)));
+}
+
+/**
+ * Divide two magnitudes, by Knuth's algorithm D, where m is no less than n
+ * and v has no leading zero, into m - n + 1 limbs of q and n limbs of r.
+ */
+static int
+magdivmod (uint32_t *q, uint32_t *r, uint32_t const *u, size_t m,
+           uint32_t const *v, size_t n)
+{
+  if (n == 1)
+    {
+      uint64_t k = 0;
+
+      for (size_t j = m; j-- > 0; )
+        {
+          k    = (k << LIMB_BITS) | u[j];
+          q[j] = (uint32_t) (k / v[0]);
+          k   -= (uint64_t) q[j] * v[0];
+        }
+
+      r[0] = (uint32_t) k;
+
+      return (EXIT_SUCCESS);
+    }
+
+  int const s = magclz (v[n - 1]);
+
+  uint32_t *vn = (uint32_t *) malloc ((n + m + 1) * sizeof (uint32_t));
+
+  if (vn == NULL)
+    {
+      return (EXIT_MALLOC);
+    }
+
+  uint32_t *un = vn + n;
+
+  /* normalise, such that the leading limb of the divisor has its top bit set */
+
+  for (size_t i = n - 1; i > 0; i--)
+    {
+      vn[i] = magfunnel (v[i], v[i - 1], s);
+    }
+
+  vn[0] = v[0] << s;
+  un[m] = magfunnel (0, u[m - 1], s);
+
+  for (size_t i = m - 1; i > 0; i--)
+    {
+      un[i] = magfunnel (u[i], u[i - 1], s);
+    }
+
+  un[0] = u[0] << s;
+
+  for (size_t j = m - n + 1; j-- > 0; )
+    {
+      uint64_t const numerator = (uint64_t) un[j + n] << LIMB_BITS
+                                 | un[j + n - 1];
+
+      uint64_t qhat = numerator / vn[n - 1];
+      uint64_t rhat = numerator - qhat * vn[n - 1];
+
+      while (qhat >= LIMB_BASE
+             || qhat * vn[n - 2] > ((rhat << LIMB_BITS) | un[j + n - 2]))
+        {
+          qhat--;
+          rhat += vn[n - 1];
+
+          if (rhat >= LIMB_BASE)
+            {
+              break;
+            }
+        }
+
+      /* multiply and subtract */
+
+      int64_t k = 0;
+      int64_t t;
+
+      for (size_t i = 0; i < n; i++)
+        {
+          uint64_t const p = qhat * vn[i];
+
+          t = (int64_t) un[i + j] - k - (int64_t) (p & 0xffffffffu);
+          un[i + j] = (uint32_t) t;
+          k = (int64_t) (p >> LIMB_BITS) - (t >> LIMB_BITS);
+        }
+
+      t = (int64_t) un[j + n] - k;
+      un[j + n] = (uint32_t) t;
+
+      q[j] = (uint32_t) qhat;
+
+      if (t < 0) /* subtracted too much: add back */
+        {
+          q[j]--;
+          k = 0;
+
+          for (size_t i = 0; i < n; i++)
+            {
+              t = (int64_t) un[i + j] + vn[i] + k;
+              un[i + j] = (uint32_t) t;
+              k = t >> LIMB_BITS;
+            }
+
+          un[j + n] += (uint32_t) k;
+        }
+    }
+
+  /* unnormalise the remainder */
+
+  for (size_t i = 0; i < n - 1; i++)
+    {
+      r[i] = s == 0 ? un[i] : magfunnel (un[i + 1], un[i], LIMB_BITS - s);
+    }
+
+  r[n - 1] = un[n - 1] >> s;
+
+  free (vn);
+
+  return (EXIT_SUCCESS);
+}
+
+/*****************************************************************************
+*                                  Bignums                                   *
+*****************************************************************************/
+
+/**
+ * Allocate a bignum, every limb of which is zeroed.
+ */
+static struct bignum *
+bigalloc (size_t length)
+{
+  if (length > ((size_t)-1 - sizeof (struct bignum)) / sizeof (uint32_t))
+    {
+      return (NULL);
+    }
+
+  struct bignum *big = (struct bignum *) calloc (1, sizeof (struct bignum)
+                                                 + length * sizeof (uint32_t));
+
+  if (big != NULL)
+    {
+      big->length = length;
+    }
+
+  return (big);
+}
+
+/**
+ * View a number as a sign and magnitude.
+ */
+static void
+numview (struct view *view, struct number const *number)
+{
+  if (number->big != NULL)
+    {
+      view->negative = number->big->negative;
+      view->length   = number->big->length;
+      view->limbs    = number->big->limbs;
+
+      return;
+    }
+
+  unsigned long long const m = number->small < 0
+                             ? 0ULL - (unsigned long long) number->small
+                             : (unsigned long long) number->small;
+
+  view->negative  = number->small < 0;
+  view->buffer[0] = (uint32_t) m;
+  view->buffer[1] = (uint32_t) (m >> LIMB_BITS);
+  view->length    = view->buffer[1] != 0 ? 2 : view->buffer[0] != 0;
+  view->limbs     = view->buffer;
+}
+
+/**
+ * Set a number to a bignum, demoting it to a machine word if it fits.
+ */
+static void
+numset (struct number *number, struct bignum *big)
+{
+  while (big->length > 0 && big->limbs[big->length - 1] == 0)
+    {
+      big->length--;
+    }
+
+  numfree (number);
+
+  if (big->length <= 2)
+    {
+      unsigned long long m = 0;
+
+      for (size_t i = big->length; i-- > 0; )
+        {
+          m = m << LIMB_BITS | big->limbs[i];
+        }
+
+      if (!big->negative && m <= (unsigned long long) LLONG_MAX)
+        {
+          number->small = (long long) m;
+          free (big);
+
+          return;
+        }
+
+      if (big->negative && m <= (unsigned long long) LLONG_MAX + 1)
+        {
+          number->small = -(long long) (m - 1) - 1;
+          free (big);
+
+          return;
+        }
+    }
+
+  number->big = big;
+}
+
+/*
+ * The functions below are taken only once a number outgrows its small value,
+ * thus are placed apart from the small paths by OPTION_COLD_CODE, such that
+ * each of numadd() and the like remains a few instructions.
+ */
+
+/**
+ * Add two views, negating the second if asked, thus also subtracting.
+ */
+static OPTION_COLD_CODE int
+numaddview (struct number *z, struct view const *x, struct view const *y,
+            int negate)
+{
+  int const negative = y->negative ^ negate;
+
+  size_t const length = (x->length > y->length ? x->length : y->length) + 1;
+
+  struct bignum *big = bigalloc (length);
+
+  if (big == NULL)
+    {
+      return (EXIT_MALLOC);
+    }
+
+  if (x->negative == negative)
+    {
+      magadd (big->limbs, x->limbs, x->length, y->limbs, y->length);
+
+      big->negative = x->negative;
+    }
+  else if (magcmp (x->limbs, x->length, y->limbs, y->length) >= 0)
+    {
+      magsub (big->limbs, x->limbs, x->length, y->limbs, y->length);
+
+      big->negative = x->negative;
+    }
+  else
+    {
+      magsub (big->limbs, y->limbs, y->length, x->limbs, x->length);
+
+      big->negative = negative;
+    }
+
+  numset (z, big);
+
+  return (EXIT_SUCCESS);
+}
+
+/**
+ * Multiply two views.
+ */
+static OPTION_COLD_CODE int
+nummulview (struct number *z, struct view const *x, struct view const *y)
+{
+  struct bignum *big = bigalloc (x->length + y->length);
+
+  if (big == NULL)
+    {
+      return (EXIT_MALLOC);
+    }
+
+  int const error = magmul (big->limbs, x->limbs, x->length,
+                            y->limbs, y->length);
+
+  if (error != EXIT_SUCCESS)
+    {
+      free (big);
+
+      return (error);
+    }
+
+  big->negative = x->negative ^ y->negative;
+
+  numset (z, big);
+
+  return (EXIT_SUCCESS);
+}
+
+/**
+ * Divide two numbers, into either or both of a quotient and a remainder.
+ */
+static OPTION_COLD_CODE int
+numdivmod (struct number *q, struct number *r,
+           struct number const *x, struct number const *y)
+{
+  struct view a, b;
+
+  numview (&a, x);
+  numview (&b, y);
+
+  if (b.length == 0)
+    {
+      return (EXIT_UNDEFINED);
+    }
+
+  if (magcmp (a.limbs, a.length, b.limbs, b.length) < 0)
+    {
+      int error = EXIT_SUCCESS;
+
+      if (r != NULL && r != x)
+        {
+          error = numcopy (r, x);
+        }
+
+      if (q != NULL)
+        {
+          numfree (q);
+        }
+
+      return (error);
+    }
+
+  struct bignum *quotient  = bigalloc (a.length - b.length + 1);
+  struct bignum *remainder = bigalloc (b.length);
+
+  if (quotient == NULL || remainder == NULL)
+    {
+      free (quotient);
+      free (remainder);
+
+      return (EXIT_MALLOC);
+    }
+
+  int const error = magdivmod (quotient->limbs, remainder->limbs,
+                               a.limbs, a.length, b.limbs, b.length);
+
+  if (error != EXIT_SUCCESS)
+    {
+      free (quotient);
+      free (remainder);
+
+      return (error);
+    }
+
+  quotient->negative  = a.negative ^ b.negative;
+  remainder->negative = a.negative;
+
+  if (q != NULL)
+    {
+      numset (q, quotient);
+    }
+  else
+    {
+      free (quotient);
+    }
+
+  if (r != NULL)
+    {
+      numset (r, remainder);
+    }
+  else
+    {
+      free (remainder);
+    }
+
+  return (EXIT_SUCCESS);
+}
+
+/*****************************************************************************
+*                                  Numbers                                   *
+*****************************************************************************/
+
+/**
+ * Initialise a number; never allocates.
+ *
+ * @param number The number to initialise.
+ * @param value  The value of said number.
+ * @see          numparse() and numfree().
+ */
+void
+numinit (struct number *number, long long value)
+{
+  if (number == NULL)
+    {
+      return;
+    }
+
+  number->small = value;
+  number->big   = NULL;
+}
+
+/**
+ * Parse a number from a (signed) decimal literal.
+ *
+ * @param number The number to initialise.
+ * @param string The literal.
+ * @return       Zero on success, otherwise an error code.
+ * @see          numinit() and numstring().
+ */
+int
+numparse (struct number *number, char const *string)
+{
+  if (number == NULL || string == NULL)
+    {
+      return (EXIT_NULLPTR);
+    }
+
+  numinit (number, 0);
+
+  int const negative = *string == '-';
+
+  if (*string == '-' || *string == '+')
+    {
+      string++;
+    }
+
+  if (*string < '0' || *string > '9')
+    {
+      return (EXIT_UNDEFINED);
+    }
+
+  struct number ten, digit;
+
+  numinit (&ten, 10);
+
+  for ( ; *string >= '0' && *string <= '9'; string++)
+    {
+      numinit (&digit, negative ? '0' - *string : *string - '0');
+
+      int error = nummul (number, number, &ten);
+
+      if (error == EXIT_SUCCESS)
+        {
+          error = numadd (number, number, &digit);
+        }
+
+      if (error != EXIT_SUCCESS)
+        {
+          numfree (number);
+
+          return (error);
+        }
+    }
+
+  return (*string == '\0' ? EXIT_SUCCESS : EXIT_UNDEFINED);
+}
+
+/**
+ * Copy a number.
+ *
+ * @param z The number to copy to, which must be initialised.
+ * @param x The number to copy from.
+ * @return  Zero on success, otherwise an error code.
+ * @see     numinit().
+ */
+int
+numcopy (struct number *z, struct number const *x)
+{
+  if (z == NULL || x == NULL)
+    {
+      return (EXIT_NULLPTR);
+    }
+
+  if (z == x)
+    {
+      return (EXIT_SUCCESS);
+    }
+
+  if (x->big == NULL)
+    {
+      numfree (z);
+
+      z->small = x->small;
+
+      return (EXIT_SUCCESS);
+    }
+
+  struct bignum *big = bigalloc (x->big->length);
+
+  if (big == NULL)
+    {
+      return (EXIT_MALLOC);
+    }
+
+  memcpy (big->limbs, x->big->limbs, x->big->length * sizeof (uint32_t));
+
+  big->negative = x->big->negative;
+
+  numset (z, big);
+
+  return (EXIT_SUCCESS);
+}
+
+/**
+ * Free a number, leaving it initialised to zero.
+ *
+ * @param number The number to free.
+ * @see          numinit().
+ */
+void
+numfree (struct number *number)
+{
+  if (number == NULL)
+    {
+      return;
+    }
+
+  free (number->big);
+
+  number->small = 0;
+  number->big   = NULL;
+}
+
+/**
+ * Format a number as a decimal string.
+ *
+ * @param number The number to format.
+ * @return       A string, to be freed by free(), otherwise a null-pointer.
+ * @see          numparse().
+ */
+char *
+numstring (struct number const *number)
+{
+  if (number == NULL)
+    {
+      return (NULL);
+    }
+
+  if (number->big == NULL)
+    {
+      char *string = (char *) malloc (24);
+
+      if (string != NULL)
+        {
+          snprintf (string, 24, "%lld", number->small);
+        }
+
+      return (string);
+    }
+
+  /* peel off nine decimal digits at a time, the least significant first */
+
+  size_t length = number->big->length;
+  size_t const digits = length * 10 + 2;
+
+  uint32_t *limbs = (uint32_t *) malloc (length * sizeof (uint32_t));
+  char *string    = (char *) malloc (digits);
+
+  if (limbs == NULL || string == NULL)
+    {
+      free (limbs);
+      free (string);
+
+      return (NULL);
+    }
+
+  memcpy (limbs, number->big->limbs, length * sizeof (uint32_t));
+
+  char *it = string + digits - 1;
+
+  *it = '\0';
+
+  while (length > 0)
+    {
+      uint64_t k = 0;
+
+      for (size_t j = length; j-- > 0; )
+        {
+          k        = (k << LIMB_BITS) | limbs[j];
+          limbs[j] = (uint32_t) (k / 1000000000u);
+          k       %= 1000000000u;
+        }
+
+      while (length > 0 && limbs[length - 1] == 0)
+        {
+          length--;
+        }
+
+      for (int i = 0; i < 9 && (length > 0 || k != 0); i++, k /= 10)
+        {
+          *--it = (char) ('0' + k % 10);
+        }
+    }
+
+  if (number->big->negative)
+    {
+      *--it = '-';
+    }
+
+  memmove (string, it, (size_t) (string + digits - it));
+  free (limbs);
+
+  return (string);
+}
+
+/**
+ * Compare two numbers.
+ *
+ * @param x The first number.
+ * @param y The second number.
+ * @return  Less than, equal to, or greater than zero, as x is less than,
+ *          equal to, or greater than y.
+ */
+int
+numcmp (struct number const *x, struct number const *y)
+{
+  if (x->big == NULL && y->big == NULL)
+    {
+      return ((x->small > y->small) - (x->small < y->small));
+    }
+
+  struct view a, b;
+
+  numview (&a, x);
+  numview (&b, y);
+
+  if (a.negative != b.negative)
+    {
+      return (a.negative ? -1 : 1);
+    }
+
+  int const order = magcmp (a.limbs, a.length, b.limbs, b.length);
+
+  return (a.negative ? -order : order);
+}
+
+/*****************************************************************************
+*                                 Arithmetic                                 *
+*****************************************************************************/
+
+/**
+ * Add two numbers.
+ *
+ * @param z The sum.
+ * @param x The augend.
+ * @param y The addend.
+ * @return  Zero on success, otherwise an error code.
+ */
+int
+numadd (struct number *z, struct number const *x, struct number const *y)
+{
+  if (x->big == NULL && y->big == NULL)
+    {
+      long long sum;
+
+      if (smladd (x->small, y->small, &sum) == EXIT_SUCCESS)
+        {
+          numfree (z);
+
+          z->small = sum;
+
+          return (EXIT_SUCCESS);
+        }
+    }
+
+  struct view a, b;
+
+  numview (&a, x);
+  numview (&b, y);
+
+  return (numaddview (z, &a, &b, 0));
+}
+
+/**
+ * Subtract two numbers.
+ *
+ * @param z The difference.
+ * @param x The minuend.
+ * @param y The subtrahend.
+ * @return  Zero on success, otherwise an error code.
+ */
+int
+numsub (struct number *z, struct number const *x, struct number const *y)
+{
+  if (x->big == NULL && y->big == NULL)
+    {
+      long long difference;
+
+      if (smlsub (x->small, y->small, &difference) == EXIT_SUCCESS)
+        {
+          numfree (z);
+
+          z->small = difference;
+
+          return (EXIT_SUCCESS);
+        }
+    }
+
+  struct view a, b;
+
+  numview (&a, x);
+  numview (&b, y);
+
+  return (numaddview (z, &a, &b, 1));
+}
+
+/**
+ * Multiply two numbers.
+ *
+ * @param z The product.
+ * @param x The multiplicand.
+ * @param y The multiplier.
+ * @return  Zero on success, otherwise an error code.
+ */
+int
+nummul (struct number *z, struct number const *x, struct number const *y)
+{
+  if (x->big == NULL && y->big == NULL)
+    {
+      long long product;
+
+      if (smlmul (x->small, y->small, &product) == EXIT_SUCCESS)
+        {
+          numfree (z);
+
+          z->small = product;
+
+          return (EXIT_SUCCESS);
+        }
+    }
+
+  struct view a, b;
+
+  numview (&a, x);
+  numview (&b, y);
+
+  return (nummulview (z, &a, &b));
+}
+
+/**
+ * Divide two numbers, truncating towards zero.
+ *
+ * @param z The quotient.
+ * @param x The dividend.
+ * @param y The divisor.
+ * @return  Zero on success, otherwise an error code.
+ */
+int
+numdiv (struct number *z, struct number const *x, struct number const *y)
+{
+  if (x->big == NULL && y->big == NULL && y->small != 0
+      && !(x->small == LLONG_MIN && y->small == -1))
+    {
+      long long const quotient = x->small / y->small;
+
+      numfree (z);
+
+      z->small = quotient;
+
+      return (EXIT_SUCCESS);
+    }
+
+  return (numdivmod (z, NULL, x, y));
+}
+
+/**
+ * The remainder of two numbers, with the sign of the dividend.
+ *
+ * @param z The remainder.
+ * @param x The dividend.
+ * @param y The divisor.
+ * @return  Zero on success, otherwise an error code.
+ */
+int
+nummod (struct number *z, struct number const *x, struct number const *y)
+{
+  if (x->big == NULL && y->big == NULL && y->small != 0)
+    {
+      long long const remainder = y->small == -1 ? 0 : x->small % y->small;
+
+      numfree (z);
+
+      z->small = remainder;
+
+      return (EXIT_SUCCESS);
+    }
+
+  return (numdivmod (NULL, z, x, y));
+}
@@ -0,0 +1,104 @@
+/*****************************************************************************
+*                   Copyright (c) 2020-2021 Jack C. Lloyd.                   *
+*                            All rights reserved.                            *
+*****************************************************************************/
+
+#include "../include/context.h"
+#include "../include/options.h"
+
+/*****************************************************************************
+*                              Standard Library                              *
+*****************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+
+/*****************************************************************************
+*                                 Data Types                                 *
+*****************************************************************************/
+
+/**
+ * An option data structure, naming an option on the command line and as an
+ * attribute.
+ */
+struct option
+{
+  char const *flag;      /**< The name on the command line. */
+  char const *attribute; /**< The name as an attribute. */
+  int value;             /**< The value of the option. */
+};
+
+/**
+ * The table of options, terminated by a null option; an option with a null
+ * flag is given as an attribute alone.
+ */
+static struct option const table[] =
+{
+  { "-ffast-math", "fastmath", OPTION_FASTMATH },
+  { "-fbignum",    "bignum",   OPTION_BIGNUM   },
+  { NULL,          "hot",      OPTION_HOT      },
+  { NULL,          "cold",     OPTION_COLD     },
+  { NULL,          NULL,       0               }
+};
+
+/*****************************************************************************
+*                                  Options                                   *
+*****************************************************************************/
+
+/**
+ * Parse a command-line option.
+ *
+ * @param argument The command-line argument, beginning with '-'.
+ * @param options  A pointer to the options, to which said option is added.
+ * @return         Zero on success, otherwise an error code.
+ * @see            optattribute().
+ */
+int
+optparse (char const *argument, int *options)
+{
+  if (argument == NULL || options == NULL)
+    {
+      return (EXIT_NULLPTR);
+    }
+
+  for (struct option const *it = table; it->value != 0; it++)
+    {
+      if (it->flag != NULL && strcmp (it->flag, argument) == EXIT_SUCCESS)
+        {
+          *options |= it->value;
+
+          return (EXIT_SUCCESS);
+        }
+    }
+
+  return (EXIT_UNDEFINED);
+}
+
+/**
+ * Parse an attribute, the name following an '@'.
+ *
+ * @param name    The name of the attribute.
+ * @param options A pointer to the options, to which said attribute is added.
+ * @return        Zero on success, otherwise an error code.
+ * @see           optparse().
+ */
+int
+optattribute (char const *name, int *options)
+{
+  if (name == NULL || options == NULL)
+    {
+      return (EXIT_NULLPTR);
+    }
+
+  for (struct option const *it = table; it->value != 0; it++)
+    {
+      if (strcmp (it->attribute, name) == EXIT_SUCCESS)
+        {
+          *options |= it->value;
+
+          return (EXIT_SUCCESS);
+        }
+    }
+
+  return (EXIT_UNDEFINED);
+}
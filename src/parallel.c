@@ -0,0 +1,314 @@
+/*****************************************************************************
+*                   Copyright (c) 2020-2021 Jack C. Lloyd.                   *
+*                            All rights reserved.                            *
+*****************************************************************************/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "../include/atomic.h"
+#include "../include/context.h"
+#include "../include/parallel.h"
+
+/*****************************************************************************
+*                              Standard Library                              *
+*****************************************************************************/
+
+#include <stdlib.h>
+
+/*****************************************************************************
+*                                   POSIX                                    *
+*****************************************************************************/
+
+#include <pthread.h>
+#include <unistd.h>
+
+/*****************************************************************************
+*                                 Data Types                                 *
+*****************************************************************************/
+
+/**
+ * A pool data structure, holding its workers and the loop they run.
+ */
+struct pool
+{
+  pthread_mutex_t mutex;      /**< Guards every field but next and busy. */
+  pthread_cond_t start;       /**< Signalled as a loop is issued. */
+  pthread_cond_t done;        /**< Signalled as the last worker finishes. */
+  unsigned long generation;   /**< The number of loops issued. */
+  size_t pending;             /**< The workers yet to finish said loop. */
+  int stop;                   /**< Whether the workers are to return. */
+  atmboolean_t busy;          /**< Whether a loop is running. */
+  atmnatural64_t next;        /**< The next chunk to run. */
+  size_t chunks;              /**< The number of chunks of said loop. */
+  size_t begin;               /**< The first iteration of said loop. */
+  size_t end;                 /**< The iteration after the last thereof. */
+  kernel_t kernel;            /**< The body of said loop. */
+  void *argument;             /**< The argument of said body. */
+  size_t threads;             /**< The number of workers. */
+  pthread_t workers[];        /**< The workers. */
+};
+
+/**
+ * Run the chunks of the current loop of a pool until none remain.
+ *
+ * @param pool The pool.
+ */
+static void
+parwork (struct pool *pool)
+{
+  size_t const length = pool->end - pool->begin;
+  size_t const size   = length / pool->chunks;
+  size_t const extra  = length % pool->chunks;
+
+  for (;;)
+    {
+      size_t const chunk = (size_t) atmnatural64add (&pool->next, 1,
+                                                      ATOMIC_RELAXED);
+
+      if (chunk >= pool->chunks)
+        {
+          return;
+        }
+
+      /* the first (length % chunks) chunks take an extra iteration */
+
+      size_t const begin = pool->begin + chunk * size
+                         + (chunk < extra ? chunk : extra);
+      size_t const end   = begin + size + (chunk < extra);
+
+      pool->kernel (begin, end, chunk, pool->argument);
+    }
+}
+
+/**
+ * The body of a worker, waiting upon, then running, each loop of a pool.
+ *
+ * @param argument The pool.
+ * @return         A null-pointer.
+ */
+static void *
+parworker (void *argument)
+{
+  struct pool *pool = (struct pool *) argument;
+
+  unsigned long seen = 0; /* not as read, lest a loop issued early be missed */
+
+  pthread_mutex_lock (&pool->mutex);
+
+  for (;;)
+    {
+      while (!pool->stop && pool->generation == seen)
+        {
+          pthread_cond_wait (&pool->start, &pool->mutex);
+        }
+
+      if (pool->stop)
+        {
+          break;
+        }
+
+      seen = pool->generation;
+
+      pthread_mutex_unlock (&pool->mutex);
+
+      parwork (pool);
+
+      pthread_mutex_lock (&pool->mutex);
+
+      if (--pool->pending == 0)
+        {
+          pthread_cond_signal (&pool->done);
+        }
+    }
+
+  pthread_mutex_unlock (&pool->mutex);
+
+  return (NULL);
+}
+
+/*****************************************************************************
+*                                   Pools                                    *
+*****************************************************************************/
+
+/**
+ * Allocate a pool of worker threads.
+ *
+ * @param threads The number of workers, besides the caller; if zero, one
+ *                fewer than the processors online.
+ * @return        An initialised pool on success, otherwise a null-pointer.
+ * @see           parfree().
+ */
+struct pool *
+paralloc (size_t threads)
+{
+  if (threads == 0)
+    {
+      long const processors = sysconf (_SC_NPROCESSORS_ONLN);
+
+      threads = processors > 1 ? (size_t) processors - 1 : 0;
+    }
+
+  struct pool *pool = (struct pool *) calloc (1, sizeof (struct pool)
+                                              + threads * sizeof (pthread_t));
+
+  if (pool == NULL)
+    {
+      return (NULL);
+    }
+
+  if (pthread_mutex_init (&pool->mutex, NULL) != 0)
+    {
+      free (pool);
+
+      return (NULL);
+    }
+
+  if (pthread_cond_init (&pool->start, NULL) != 0)
+    {
+      pthread_mutex_destroy (&pool->mutex);
+      free (pool);
+
+      return (NULL);
+    }
+
+  if (pthread_cond_init (&pool->done, NULL) != 0)
+    {
+      pthread_cond_destroy (&pool->start);
+      pthread_mutex_destroy (&pool->mutex);
+      free (pool);
+
+      return (NULL);
+    }
+
+  for ( ; pool->threads < threads; pool->threads++)
+    {
+      if (pthread_create (&pool->workers[pool->threads], NULL, parworker,
+                          pool) != 0)
+        {
+          parfree (pool);
+
+          return (NULL);
+        }
+    }
+
+  return (pool);
+}
+
+/**
+ * Free a pool, joining its workers.
+ *
+ * @param pool The pool to free.
+ * @see        paralloc().
+ */
+void
+parfree (struct pool *pool)
+{
+  if (pool == NULL)
+    {
+      return;
+    }
+
+  pthread_mutex_lock (&pool->mutex);
+
+  pool->stop = 1;
+
+  pthread_cond_broadcast (&pool->start);
+  pthread_mutex_unlock (&pool->mutex);
+
+  for (size_t i = 0; i < pool->threads; i++)
+    {
+      pthread_join (pool->workers[i], NULL);
+    }
+
+  pthread_cond_destroy (&pool->done);
+  pthread_cond_destroy (&pool->start);
+  pthread_mutex_destroy (&pool->mutex);
+  free (pool);
+}
+
+/**
+ * The number of chunks into which a pool may split a loop.
+ *
+ * @param pool The pool.
+ * @return     Said number, no less than one.
+ * @see        parfor().
+ */
+size_t
+parchunks (struct pool const *pool)
+{
+  if (pool == NULL)
+    {
+      return (1);
+    }
+
+  return ((pool->threads + 1) * PARALLEL_OVERSPLIT);
+}
+
+/**
+ * Run a loop, whose iterations are independent, across the workers of a
+ * pool and the caller; a loop of fewer than PARALLEL_THRESHOLD iterations,
+ * or one issued whilst another runs, is run by the caller alone, as chunk
+ * zero.
+ *
+ * @param pool     The pool.
+ * @param begin    The first iteration.
+ * @param end      The iteration after the last.
+ * @param kernel   The body of said loop.
+ * @param argument The argument of said body.
+ * @return         Zero on success, otherwise an error code.
+ * @see            parchunks().
+ */
+int
+parfor (struct pool *pool, size_t begin, size_t end, kernel_t kernel,
+        void *argument)
+{
+  if (pool == NULL || kernel == NULL)
+    {
+      return (EXIT_NULLPTR);
+    }
+
+  if (end <= begin)
+    {
+      return (EXIT_SUCCESS);
+    }
+
+  /* too short to repay waking the workers, or nested within a loop */
+
+  if (end - begin < PARALLEL_THRESHOLD || pool->threads == 0
+      || atmbooleanexchange (&pool->busy, 1, ATOMIC_ACQUIRE))
+    {
+      kernel (begin, end, 0, argument);
+
+      return (EXIT_SUCCESS);
+    }
+
+  pthread_mutex_lock (&pool->mutex);
+
+  pool->begin    = begin;
+  pool->end      = end;
+  pool->kernel   = kernel;
+  pool->argument = argument;
+  pool->chunks   = parchunks (pool);
+  pool->pending  = pool->threads;
+  pool->generation++;
+
+  atmnatural64store (&pool->next, 0, ATOMIC_RELAXED);
+
+  pthread_cond_broadcast (&pool->start);
+  pthread_mutex_unlock (&pool->mutex);
+
+  parwork (pool);
+
+  pthread_mutex_lock (&pool->mutex);
+
+  while (pool->pending > 0)
+    {
+      pthread_cond_wait (&pool->done, &pool->mutex);
+    }
+
+  pthread_mutex_unlock (&pool->mutex);
+
+  atmbooleanstore (&pool->busy, 0, ATOMIC_RELEASE);
+
+  return (EXIT_SUCCESS);
+}
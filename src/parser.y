@@ -1,8 +1,49 @@
 %define parse.error verbose
 
+%code requires
+{
+#include "./include/convention.h"
+#include "./include/range.h"
+
+/* the value of an expression: its range, its type (see type.h), and its
+   node (see evaluate.h) */
+
+struct node;
+
+struct value
+{
+  struct range range;
+  int type;
+  struct node *node;
+};
+
+/* the arguments of a call: their nodes, their types, their number, and the
+   text of the first, if a string literal, as of a format */
+
+struct arguments
+{
+  struct node *list;
+  int types[CONVENTION_LENGTH];
+  size_t count;
+  char *format;
+};
+
+/* the procedure called: its convention, its name, if generic, and whether
+   it is io.out, thus of a format */
+
+struct target
+{
+  struct convention const *convention;
+  char *name;
+  int output;
+};
+}
+
 %{
+#include <errno.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "parser.tab.h"
 
@@ -17,9 +58,91 @@ yylex (void);
 void
 yyerror (char const *str);
 
+void
+yyrange (int result);
+
+int
+yyconstant (struct value const *x);
+
+void
+yytype (int *z, struct value const *x, struct value const *y);
+
+void
+yynegate (struct value *z, struct value const *x);
+
+void
+yyopaque (int type);
+
+void
+yyformat (struct arguments const *arguments);
+
+void
+yybind (char *name, int type, struct value const *initial);
+
+int
+yyparameter (char const *name);
+
+void
+yygeneric (char *name);
+
+int
+yytypename (char const *name);
+
 #include "./include/context.h"
+#include "./include/evaluate.h"
+#include "./include/format.h"
+#include "./include/frame.h"
+#include "./include/generic.h"
+#include "./include/options.h"
+#include "./include/type.h"
+
+void
+yycall (struct value *z, struct target const *procedure,
+        struct arguments const *arguments);
+
+void
+yyinstance (struct target const *procedure,
+            struct arguments const *arguments);
 
 struct context *context;
+
+struct conventions *conventions;
+
+struct convention *convention = NULL; /* that of the current procedure */
+
+struct convention const *callee = NULL; /* that of the last identifier */
+
+char *called = NULL; /* the name thereof, if generic */
+
+int module = 0; /* whether the last identifiers name the module io */
+
+int output = 0; /* whether they name io.out */
+
+char *quote = NULL; /* the text of the last string literal */
+
+struct node *quoted = NULL; /* the node thereof, as an expression */
+
+struct instances *instances;
+
+char *generics[GENERIC_LENGTH]; /* those of the type parameters */
+
+int local = 0; /* whether parameters are those of a "let" */
+
+struct evaluator *evaluator;
+
+char *names[CONVENTION_LENGTH]; /* those of the parameters */
+
+int parameter = -1; /* the index of the last identifier, if a parameter */
+
+int pure = 0; /* whether the current procedure does nothing but return */
+
+int options = 0; /* the options given on the command line */
+
+int attributes = 0; /* the options of the current procedure */
+
+int escape = FRAME_LOCAL; /* whether identifiers escape their frame */
+
+int binding = 0; /* whether identifiers are of the initialisers of a "let" */
 %}
 
 %define api.value.type union
@@ -50,24 +173,39 @@ struct context *context;
 
 %token <char *> LITERAL_BOOLEAN
 %token <char *> LITERAL_NATURAL
-%token <char *> LITERAL_INTEGER
 %token <char *> LITERAL_REAL
 %token <char *> LITERAL_CHARACTER
 %token <char *> LITERAL_STRING
 
+%token TYPE_ATOMIC    "atomic"
 %token TYPE_BOOLEAN   "boolean"
 %token TYPE_NATURAL   "natural"
+%token TYPE_NATURAL8  "natural8"
+%token TYPE_NATURAL16 "natural16"
+%token TYPE_NATURAL32 "natural32"
+%token TYPE_NATURAL64 "natural64"
 %token TYPE_INTEGER   "integer"
+%token TYPE_INTEGER8  "integer8"
+%token TYPE_INTEGER16 "integer16"
+%token TYPE_INTEGER32 "integer32"
+%token TYPE_INTEGER64 "integer64"
 %token TYPE_REAL      "real"
+%token TYPE_REAL32    "real32"
+%token TYPE_REAL64    "real64"
 %token TYPE_CHARACTER "character"
 %token TYPE_STRING    "string"
 
 %token <char *> IDENTIFIER
 
+%type <int> attributes_opt type modifier scalar identifiers
+%type <struct arguments> arguments_opt arguments
+%type <struct value> literal expression call
+
 %token ASSIGNMENT ":="
 
 %left '+' '-'
 %left '*' '/' '%'
+%precedence NEGATION
 
 %%
 
@@ -77,7 +215,114 @@ program:
 ;
 
 procedure:
-  IDENTIFIER '(' parameters_opt ')' "begin" statements "end"
+  attributes_opt IDENTIFIER
+  {
+    attributes = options | $[attributes_opt];
+
+    if ((attributes & OPTION_HOT) && (attributes & OPTION_COLD))
+      {
+        yyerror ("conflicting attributes");
+      }
+
+    /* its options are held apart from the escape of its name, FRAME_ESCAPE
+       sharing a bit with OPTION_FASTMATH */
+
+    ctxinsert (context, $[IDENTIFIER], FRAME_LOCAL | KIND_NONE);
+    ctxpush (context);
+
+    if (cnvsearch (conventions, $[IDENTIFIER]) != NULL)
+      {
+        yyerror ("procedure redefined");
+      }
+
+    convention = cnvdefine (conventions, $[IDENTIFIER]);
+
+    if (convention != NULL)
+      {
+        convention->options = attributes; /* as consulted by a backend */
+      }
+
+    local = 0;
+    pure = 1;
+  }
+  generics_opt '(' parameters_opt ')'
+  {
+    local = 1;
+
+    /* each type parameter is deduced from the parameters of its type */
+
+    for (size_t i = 0; convention != NULL && i < convention->generics; i++)
+      {
+        int deduced = 0;
+
+        for (size_t j = 0; j < convention->length; j++)
+          {
+            int const type = convention->parameters[j].type;
+
+            deduced |= (type & ~CLASS_COMPOUND) == gentype (i);
+          }
+
+        if (!deduced)
+          {
+            yyerror ("type parameter not deducible");
+          }
+      }
+  }
+  "begin" statements "end"
+  {
+    /* identifiers bound to FRAME_LOCAL may be allocated by frmalloc () */
+
+    /* a procedure for which cnvframeless () holds sets up no frame */
+
+    if (convention != NULL && !pure)
+      {
+        convention->body = NULL; /* a call thereto is left to run time */
+      }
+
+    for (size_t i = 0; i < CONVENTION_LENGTH; i++)
+      {
+        free (names[i]);
+        names[i] = NULL;
+      }
+
+    for (size_t i = 0; i < GENERIC_LENGTH; i++)
+      {
+        free (generics[i]);
+        generics[i] = NULL;
+      }
+
+    ctxpop (context);
+    convention = NULL;
+    free ($[IDENTIFIER]);
+  }
+;
+
+attributes_opt:
+  attributes_opt '@' IDENTIFIER
+  {
+    $$ = $1;
+
+    if (optattribute ($[IDENTIFIER], &$$) != EXIT_SUCCESS)
+      {
+        yyerror ("unknown attribute");
+      }
+
+    free ($[IDENTIFIER]);
+  }
+| %empty
+  {
+    $$ = 0;
+  }
+;
+
+generics_opt:
+  '<' generics '>'
+| %empty
+;
+
+generics:
+  generics ',' IDENTIFIER { yygeneric ($[IDENTIFIER]); }
+| IDENTIFIER              { yygeneric ($[IDENTIFIER]); }
 ;
 
 parameters_opt:
@@ -93,54 +338,124 @@ parameters:
 parameter:
   IDENTIFIER ':' type
   {
-    free ($[IDENTIFIER]);
+    ctxinsert (context, $[IDENTIFIER], FRAME_LOCAL | $[type]);
+    yybind ($[IDENTIFIER], $[type], NULL);
   }
 | IDENTIFIER ":=" expression
   {
-    free ($[IDENTIFIER]);
+    int type = $[expression].type;
+
+    if (yyconstant (&$[expression])) /* no narrower than the default */
+      {
+        int const fallback = type & CLASS_NATURAL ? KIND_NATURAL
+                                                  : KIND_INTEGER;
+
+        typwiden (type, fallback, &type);
+      }
+
+    ctxinsert (context, $[IDENTIFIER], FRAME_LOCAL | type);
+    yybind ($[IDENTIFIER], type, &$[expression]);
   }
 ;
 
 type:
   type modifier
-| "boolean"
-| "natural"
-| "integer"
-| "real"
-| "character"
-| "string"
+  {
+    if ($1 & CLASS_PROCEDURE) /* of an array of procedures, or the like */
+      {
+        yyerror ("invalid type");
+      }
+
+    $$ = $1 | $2;
+  }
+| type '<' LITERAL_NATURAL '>'
+  {
+    errno = 0;
+
+    long long const lanes = strtoll ($[LITERAL_NATURAL], NULL, 10);
+
+    if (errno == ERANGE || typvector ($1, lanes, &$$) != EXIT_SUCCESS)
+      {
+        yyerror ("invalid vector");
+      }
+
+    free ($[LITERAL_NATURAL]);
+  }
+| "atomic" scalar
+  {
+    if (typatomic ($[scalar], &$$) != EXIT_SUCCESS)
+      {
+        yyerror ("invalid atomic");
+      }
+  }
+| scalar
+;
+
+scalar:
+  "boolean"     { $$ = KIND_BOOLEAN;        }
+| "natural"     { $$ = KIND_NATURAL;        }
+| "natural8"    { $$ = KIND_NATURAL8;       }
+| "natural16"   { $$ = KIND_NATURAL16;      }
+| "natural32"   { $$ = KIND_NATURAL32;      }
+| "natural64"   { $$ = KIND_NATURAL64;      }
+| "integer"     { $$ = KIND_INTEGER;        }
+| "integer8"    { $$ = KIND_INTEGER8;       }
+| "integer16"   { $$ = KIND_INTEGER16;      }
+| "integer32"   { $$ = KIND_INTEGER32;      }
+| "integer64"   { $$ = KIND_INTEGER64;      }
+| "real"        { $$ = KIND_REAL;           }
+| "real32"      { $$ = KIND_REAL32;         }
+| "real64"      { $$ = KIND_REAL64;         }
+| "character"   { $$ = KIND_CHARACTER;      }
+| "string"      { $$ = KIND_STRING;         }
+| IDENTIFIER
+  {
+    if (($$ = yytypename ($[IDENTIFIER])) == KIND_NONE)
+      {
+        yyerror ("unknown type");
+      }
+
+    free ($[IDENTIFIER]);
+  }
 ;
 
 modifier:
-  '[' ']'
-| '{' '}'
-| '(' ')'
+  '[' ']' { $$ = CLASS_COMPOUND;  }
+| '{' '}' { $$ = CLASS_COMPOUND;  }
+| '(' ')' { $$ = CLASS_PROCEDURE; }
 ;
 
 literal:
   LITERAL_BOOLEAN
   {
+    rngnone (&$$.range);
+    $$.type = KIND_BOOLEAN;
     free ($[LITERAL_BOOLEAN]);
   }
 | LITERAL_NATURAL
   {
+    yyrange (rngliteral (&$$.range, RANGE_NATURAL, $[LITERAL_NATURAL]));
+    $$.type = typfit (CLASS_NATURAL, $$.range.minimum, $$.range.maximum);
     free ($[LITERAL_NATURAL]);
   }
-| LITERAL_INTEGER
-  {
-    free ($[LITERAL_INTEGER]);
-  }
 | LITERAL_REAL
   {
+    rngnone (&$$.range);
+    $$.type = KIND_REAL;
     free ($[LITERAL_REAL]);
   }
 | LITERAL_CHARACTER
   {
+    rngnone (&$$.range);
+    $$.type = KIND_CHARACTER;
     free ($[LITERAL_CHARACTER]);
   }
 | LITERAL_STRING
   {
-    free ($[LITERAL_STRING]);
+    rngnone (&$$.range);
+    $$.type = KIND_STRING;
+    free (quote);
+    quote = $[LITERAL_STRING]; /* kept, as that of a format */
   }
 ;
 
@@ -150,11 +465,32 @@ statements:
 ;
 
 statement:
-  "let" parameters
+  "let" { binding = 1; } parameters { binding = 0; }
 | "if" expression "begin" statement clause "end"
+  {
+    pure = 0;
+    yyopaque ($[expression].type);
+  }
 | "while" expression "begin" statement clause "end"
+  {
+    pure = 0;
+    yyopaque ($[expression].type);
+  }
 | "until" expression "begin" statement clause "end"
-| "return" expression
+  {
+    pure = 0;
+    yyopaque ($[expression].type);
+  }
+| "return" { escape = FRAME_ESCAPE; } expression
+  {
+    escape = FRAME_LOCAL;
+
+    if (pure && convention != NULL && convention->body == NULL)
+      {
+        convention->body = $[expression].node; /* by evlcall (), if pure */
+      }
+  }
+| call                                                       { pure = 0; }
 | %empty
 ;
 
@@ -168,30 +504,693 @@ clause:
 
 expression:
   identifiers
+  {
+    $$.type = $1 & ~CLASS_ATOMIC; /* an atomic is read, as a whole */
+
+    if ($$.type == KIND_NONE && callee != NULL) /* a procedure, as a value */
+      {
+        $$.type = CLASS_PROCEDURE;
+      }
+
+    /* a variable takes every value of its type, e.g. [0, 255] of a natural8,
+       such that an operation thereon is checked only if it may overflow */
+
+    int const base = $$.type & CLASS_MASK;
+
+    rngwidth (&$$.range, $$.type & (CLASS_COMPOUND | CLASS_PROCEDURE)
+                         ? RANGE_NONE
+                         : base == CLASS_NATURAL ? RANGE_NATURAL
+                         : base == CLASS_INTEGER ? RANGE_INTEGER
+                         : RANGE_NONE,
+              ($$.type & WIDTH_MASK) >> WIDTH_SHIFT);
+
+    if (parameter >= 0) /* of the body of a pure procedure */
+      {
+        $$.node = evlparameter (evaluator, (size_t) parameter, $$.type);
+      }
+    else
+      {
+        $$.node = evlunknown (evaluator);
+      }
+  }
 | literal
-| expression '+' expression { /* ... */ }
-| expression '-' expression { /* ... */ }
-| expression '*' expression { /* ... */ }
-| expression '/' expression { /* ... */ }
-| expression '%' expression { /* ... */ }
+  {
+    $$ = $1;
+    $$.node = evlliteral (evaluator, &$1.range);
+
+    if ($1.type == KIND_STRING)
+      {
+        quoted = $$.node;
+      }
+  }
+| call
+| expression '+' expression
+  {
+    yyrange (rngadd (&$$.range, &$1.range, &$3.range));
+    yytype (&$$.type, &$1, &$3);
+    $$.node = evloperator (evaluator, '+', $1.node, $3.node,
+                           $$.type);
+  }
+| expression '-' expression
+  {
+    yyrange (rngsub (&$$.range, &$1.range, &$3.range));
+    yytype (&$$.type, &$1, &$3);
+    $$.node = evloperator (evaluator, '-', $1.node, $3.node,
+                           $$.type);
+  }
+| expression '*' expression
+  {
+    yyrange (rngmul (&$$.range, &$1.range, &$3.range));
+    yytype (&$$.type, &$1, &$3);
+    $$.node = evloperator (evaluator, '*', $1.node, $3.node,
+                           $$.type);
+  }
+| expression '/' expression
+  {
+    yyrange (rngdiv (&$$.range, &$1.range, &$3.range));
+    yytype (&$$.type, &$1, &$3);
+    $$.node = evloperator (evaluator, '/', $1.node, $3.node,
+                           $$.type);
+  }
+| expression '%' expression
+  {
+    yyrange (rngmod (&$$.range, &$1.range, &$3.range));
+    yytype (&$$.type, &$1, &$3);
+    $$.node = evloperator (evaluator, '%', $1.node, $3.node,
+                           $$.type);
+  }
+| '-' expression %prec NEGATION
+  {
+    yynegate (&$$, &$2);
+  }
+;
+
+call:
+  identifiers '('
+  <struct target>{
+    $$.convention = callee;
+    $$.name       = called; /* taken, thus freed below */
+    $$.output     = output;
+    called        = NULL;
+  }[procedure]
+  {
+    if ($[identifiers] != KIND_NONE && !($[identifiers] & CLASS_PROCEDURE))
+      {
+        yyerror ("not a procedure");
+      }
+
+    if (($[identifiers] & CLASS_PROCEDURE) && convention != NULL)
+      {
+        convention->sites++; /* recording its targets, by prcindirect () */
+      }
+  }
+  arguments_opt ')'
+  {
+    /* arguments are passed by arrcopy (), or by arrmove () on last use */
+
+    switch (cnvarguments ($[procedure].convention, $[arguments_opt].count))
+      {
+      case EXIT_MINIMISED:
+        yyerror ("too few arguments");
+        break;
+
+      case EXIT_MAXIMISED:
+        yyerror ("too many arguments");
+        break;
+
+      default: /* those omitted are passed their defaults by the caller */
+        break;
+      }
+
+    if ($[procedure].output && $[arguments_opt].format != NULL)
+      {
+        yyformat (&$[arguments_opt]);
+      }
+
+    free ($[arguments_opt].format);
+
+    if (convention != NULL)
+      {
+        convention->leaf = 0;
+      }
+
+    yycall (&$$, &$[procedure], &$[arguments_opt]);
+    free ($[procedure].name);
+  }
+;
+
+arguments_opt:
+  arguments
+| %empty
+  {
+    $$.list   = NULL;
+    $$.count  = 0;
+    $$.format = NULL;
+  }
+;
+
+arguments:
+  arguments ',' expression
+  {
+    $$ = $1;
+    $$.list = evlargument (evaluator, $1.list, $[expression].node);
+    yyopaque ($[expression].type); /* as formatted, e.g. by io.out */
+
+    if ($$.count < CONVENTION_LENGTH)
+      {
+        $$.types[$$.count] = $[expression].type;
+      }
+
+    $$.count++;
+  }
+| expression
+  {
+    $$.list     = evlargument (evaluator, NULL, $[expression].node);
+    $$.types[0] = $[expression].type;
+    $$.count    = 1;
+    $$.format   = NULL;
+
+    if ($[expression].node != NULL && $[expression].node == quoted)
+      {
+        $$.format = quote; /* taken, thus freed by the call */
+        quote     = NULL;
+      }
+
+    yyopaque ($[expression].type); /* as formatted, e.g. by io.out */
+  }
 ;
 
 identifiers:
   identifiers '.' IDENTIFIER
   {
+    $$ = KIND_NONE; /* the types of members are not yet known */
+    callee = NULL;
+    parameter = -1;
+    output = module && strcmp ($[IDENTIFIER], "out") == 0;
+    module = 0;
     free ($[IDENTIFIER]);
+    free (called);
+    called = NULL;
   }
 | IDENTIFIER
   {
-    free ($[IDENTIFIER]);
+    int value = FRAME_LOCAL | KIND_NONE;
+
+    ctxsearch (context, $[IDENTIFIER], &value);
+
+    /* a string or an array bound by a "let" shares its storage, by arrcopy
+       (), with the local so bound, thus escapes as it may */
+
+    int const shared = (value & CLASS_COMPOUND)
+                       || (value & CLASS_MASK) == CLASS_STRING;
+
+    int const escapes = binding && shared ? FRAME_ESCAPE : escape;
+
+    if (escapes != FRAME_LOCAL)
+      {
+        ctxupdate (context, $[IDENTIFIER], value | escapes);
+      }
+
+    $$ = value & KIND_MASK;
+    parameter = yyparameter ($[IDENTIFIER]);
+    module = strcmp ($[IDENTIFIER], "io") == 0;
+    output = 0;
+    callee = parameter < 0 ? cnvsearch (conventions, $[IDENTIFIER])
+                           : NULL; /* a parameter hides a procedure */
+    free (called);
+
+    if (callee != NULL && callee->generics > 0) /* to name its instances */
+      {
+        called = $[IDENTIFIER];
+      }
+    else
+      {
+        called = NULL;
+        free ($[IDENTIFIER]);
+      }
   }
 ;
 
 %%
 
+/**
+ * Report the range of an arithmetic operation; an operation which needs no
+ * check is emitted plainly, otherwise via the checked operations of
+ * arithmetic.h or, with OPTION_BIGNUM, via those of number.h, which promote
+ * rather than overflow.
+ *
+ * @param result The result of the rng*() function bounding said operation.
+ */
+void
+yyrange (int result)
+{
+  switch (result)
+    {
+    case EXIT_OVERFLOW:
+      if (!(attributes & OPTION_BIGNUM))
+        {
+          yyerror ("arithmetic overflow");
+        }
+      break;
+
+    case EXIT_UNDEFINED:
+      yyerror ("division by zero");
+      break;
+
+    default:
+      break;
+    }
+}
+
+/**
+ * Whether an expression is constant, i.e. a literal or an operation thereon.
+ *
+ * @param x The value of said expression.
+ * @return  Non-zero if so, otherwise zero.
+ */
+int
+yyconstant (struct value const *x)
+{
+  return (x->range.kind != RANGE_NONE && x->range.minimum == x->range.maximum);
+}
+
+/**
+ * Type an arithmetic operation, reporting operands with no common type; a
+ * constant operand takes the narrowest type of the other's class which holds
+ * it, thus "x + 1" is of the type of x.
+ *
+ * @param z A pointer to the type of the result.
+ * @param x The value of the first operand.
+ * @param y The value of the second operand.
+ */
+void
+yytype (int *z, struct value const *x, struct value const *y)
+{
+  int a = x->type;
+  int b = y->type;
+
+  if (yyconstant (x))
+    {
+      int const fit = typfit (b & CLASS_MASK, x->range.minimum,
+                              x->range.maximum);
+
+      a = fit != KIND_NONE ? fit : a;
+    }
+
+  if (yyconstant (y))
+    {
+      int const fit = typfit (a & CLASS_MASK, y->range.minimum,
+                              y->range.maximum);
+
+      b = fit != KIND_NONE ? fit : b;
+    }
+
+  if (typwiden (a, b, z) != EXIT_SUCCESS)
+    {
+      yyerror ("incompatible types");
+    }
+
+  yyopaque (*z);
+}
+
+/**
+ * Negate an expression, as if subtracted from zero. A literal is unsigned,
+ * thus "-1" negates a natural; the negation of a natural is of the narrowest
+ * integer holding it, e.g. an integer8 of "-1", or to which it widens, and
+ * that of an integer or a real is of its type.
+ *
+ * @param z A pointer to the value of the negation.
+ * @param x The value of the operand.
+ */
+void
+yynegate (struct value *z, struct value const *x)
+{
+  struct range zero = { RANGE_INTEGER, 0, 0 };
+
+  if (yyconstant (x) && x->range.minimum > -(long long) INTEGER_MIN)
+    {
+      zero.kind |= RANGE_WIDE; /* as of a literal beyond 32 bits */
+    }
+
+  yyrange (rngsub (&z->range, &zero, &x->range));
+
+  if (x->type & CLASS_PROCEDURE) /* of a procedure, not its result */
+    {
+      yyerror ("incompatible types");
+    }
+
+  switch (x->type & CLASS_MASK)
+    {
+    case CLASS_NATURAL:
+      if (yyconstant (z))
+        {
+          z->type = typfit (CLASS_INTEGER, z->range.minimum,
+                            z->range.maximum);
+        }
+      else if (typwiden (x->type, KIND_INTEGER8, &z->type) != EXIT_SUCCESS)
+        {
+          yyerror ("incompatible types");
+        }
+      break;
+
+    case CLASS_GENERIC:
+      yyopaque (x->type);
+      z->type = x->type;
+      break;
+
+    case CLASS_NONE:
+    case CLASS_INTEGER:
+    case CLASS_REAL:
+      z->type = x->type;
+      break;
+
+    default:
+      yyerror ("incompatible types");
+      break;
+    }
+
+  z->node = evloperator (evaluator, '-', evlliteral (evaluator, &zero),
+                         x->node, z->type);
+}
+
+/**
+ * Note a use of a value other than its return or its binding, e.g. as an
+ * operand or an argument; a procedure thus using a value of a type parameter
+ * is not opaque, its code varying with its type arguments.
+ *
+ * @param type The type of said value.
+ */
+void
+yyopaque (int type)
+{
+  if (convention != NULL && (type & CLASS_MASK) == CLASS_GENERIC)
+    {
+      convention->opaque = 0;
+    }
+}
+
+/**
+ * Check the format of a call of io.out, being its first argument, against
+ * the types of the arguments written thereby, reporting one invalid, e.g. of
+ * a stray brace or of too few or too many arguments; an argument of a type
+ * not yet known, e.g. a type parameter, is taken to be written.
+ *
+ * @param arguments The arguments of said call, of a string literal first.
+ */
+void
+yyformat (struct arguments const *arguments)
+{
+  if (arguments->count > CONVENTION_LENGTH) /* their types are not held */
+    {
+      return;
+    }
+
+  int types[CONVENTION_LENGTH];
+
+  for (size_t i = 1; i < arguments->count; i++)
+    {
+      int const type = arguments->types[i];
+      int const base = type & CLASS_MASK;
+
+      types[i - 1] = !(type & CLASS_PROCEDURE)
+                     && (base == CLASS_NONE || base == CLASS_GENERIC)
+                     ? (type & ~(CLASS_MASK | WIDTH_MASK)) | CLASS_STRING
+                     : type;
+    }
+
+  /* the text of said literal, of its quotes dropped, as freed thereafter */
+
+  char *text = arguments->format;
+
+  text[strlen (text) - 1] = '\0';
+
+  struct format format;
+
+  if (fmtcompile (&format, text + 1, types, arguments->count - 1)
+      == EXIT_UNDEFINED)
+    {
+      yyerror ("invalid format or arguments");
+    }
+}
+
+/**
+ * Bind a parameter, or a local of a "let", within the convention of the
+ * current procedure, reporting a parameter without a default following one
+ * with a default.
+ *
+ * @param name    The name of said parameter, which is taken, thus freed.
+ * @param type    The type of said parameter.
+ * @param initial The value of its default, otherwise a null-pointer.
+ */
+void
+yybind (char *name, int type, struct value const *initial)
+{
+  if (local)
+    {
+      cnvlocal (convention, type);
+      free (name);
+
+      pure = 0; /* a local is assigned, thus not pure */
+
+      return;
+    }
+
+  if (convention != NULL && convention->length < CONVENTION_LENGTH)
+    {
+      names[convention->length] = name; /* until the end of the procedure */
+    }
+  else
+    {
+      free (name);
+    }
+
+  switch (cnvparameter (convention, type, initial ? &initial->range : NULL))
+    {
+    case EXIT_MAXIMISED:
+      yyerror ("too many parameters");
+      break;
+
+    case EXIT_UNDEFINED:
+      yyerror ("parameter without default follows one with a default");
+      break;
+
+    default:
+      break;
+    }
+}
+
+/**
+ * The index of a parameter of the current procedure.
+ *
+ * @param name The name of said parameter.
+ * @return     Said index, otherwise -1.
+ */
+int
+yyparameter (char const *name)
+{
+  if (convention == NULL || local == 0)
+    {
+      return (-1); /* a default is not an expression of the parameters */
+    }
+
+  for (size_t i = convention->length; i-- > 0; )
+    {
+      if (names[i] != NULL && strcmp (names[i], name) == 0)
+        {
+          return ((int) i);
+        }
+    }
+
+  return (-1);
+}
+
+/**
+ * Add a type parameter to the current procedure, reporting too many thereof,
+ * or one redefined.
+ *
+ * @param name The name of said type parameter, which is taken, thus freed.
+ */
+void
+yygeneric (char *name)
+{
+  if (convention == NULL)
+    {
+      free (name);
+
+      return;
+    }
+
+  if (convention->generics >= GENERIC_LENGTH)
+    {
+      yyerror ("too many type parameters");
+      free (name);
+
+      return;
+    }
+
+  if (yytypename (name) != KIND_NONE)
+    {
+      yyerror ("redefined type parameter");
+      free (name);
+
+      return;
+    }
+
+  generics[convention->generics++] = name; /* until the end of the procedure */
+}
+
+/**
+ * The type of a type parameter of the current procedure, reporting a name of
+ * no such type parameter.
+ *
+ * @param name The name of said type parameter.
+ * @return     Said type, otherwise KIND_NONE.
+ */
+int
+yytypename (char const *name)
+{
+  for (size_t i = 0; convention != NULL && i < convention->generics; i++)
+    {
+      if (strcmp (generics[i], name) == 0)
+        {
+          return (gentype (i));
+        }
+    }
+
+  return (KIND_NONE);
+}
+
+/**
+ * Type a call, evaluating it as it is parsed if its arguments are constant
+ * and its procedure pure; those arguments omitted are passed their defaults.
+ * A procedure is passed only to a parameter of a procedure type, and such a
+ * parameter only a procedure.
+ *
+ * @param z         The value of said call.
+ * @param procedure The procedure called, if known.
+ * @param arguments The arguments, of a list by evlargument().
+ */
+void
+yycall (struct value *z, struct target const *procedure,
+        struct arguments const *arguments)
+{
+  struct convention const *invoked = procedure->convention;
+
+  struct node *const *body = invoked != NULL ? &invoked->body : NULL;
+
+  struct node *list = arguments->list;
+
+  for (size_t i = 0; invoked != NULL && i < arguments->count
+                     && i < invoked->length; i++)
+    {
+      int const type = arguments->types[i];
+
+      if (type != KIND_NONE
+          && ((type ^ invoked->parameters[i].type) & CLASS_PROCEDURE))
+        {
+          yyerror ("incompatible types");
+        }
+    }
+
+  if (invoked != NULL)
+    {
+      for (size_t i = arguments->count; i < invoked->length; i++)
+        {
+          struct range const *initial = &invoked->parameters[i].initial;
+
+          list = evlargument (evaluator, list,
+                              evlliteral (evaluator, initial));
+        }
+
+      if (invoked->generics > 0)
+        {
+          yyinstance (procedure, arguments);
+        }
+    }
+
+  z->node = evlcall (evaluator, body, list);
+  z->type = KIND_NONE;
+
+  if (evlrun (z->node, &z->range) != EXIT_SUCCESS)
+    {
+      rngnone (&z->range);
+
+      return;
+    }
+
+  z->node = evlliteral (evaluator, &z->range);
+  z->type = typfit (z->range.kind & RANGE_NATURAL ? CLASS_NATURAL
+                                                  : CLASS_INTEGER,
+                    z->range.minimum, z->range.maximum);
+}
+
+/**
+ * Instantiate a generic procedure, of the type arguments deduced from those
+ * of a call, reporting those which conflict; if any type argument is unknown,
+ * the call is left to the procedure itself, of its type parameters boxed.
+ *
+ * @param procedure The procedure called, generic.
+ * @param arguments The arguments of said call.
+ */
+void
+yyinstance (struct target const *procedure,
+            struct arguments const *arguments)
+{
+  struct convention const *generic = procedure->convention;
+
+  int types[GENERIC_LENGTH];
+
+  for (size_t i = 0; i < generic->generics; i++)
+    {
+      types[i] = KIND_NONE;
+    }
+
+  for (size_t i = 0; i < arguments->count && i < generic->length; i++)
+    {
+      if (gendeduce (generic->parameters[i].type, arguments->types[i], types,
+                     generic->generics) != EXIT_SUCCESS)
+        {
+          yyerror ("conflicting type arguments");
+
+          return;
+        }
+    }
+
+  for (size_t i = 0; i < generic->generics; i++)
+    {
+      if (types[i] == KIND_NONE)
+        {
+          return;
+        }
+    }
+
+  /* a procedure yet being parsed may not yet be known to but move values */
+
+  geninstance (instances, procedure->name, types, generic->generics,
+               generic != convention && generic->opaque);
+}
+
 int
 main (int argc, char *argv[])
 {
+  int files = 0;
+
+  for (int i = 1; i < argc; i++) /* separate the options from the files */
+    {
+      if (argv[i][0] != '-')
+        {
+          argv[++files] = argv[i];
+        }
+      else if (optparse (argv[i], &options) != EXIT_SUCCESS)
+        {
+          fprintf (stderr, "unknown option %s!\n", argv[i]);
+
+          return (EXIT_FAILURE);
+        }
+    }
+
+  argc = files + 1;
+
   if ((context = ctxalloc ()) == NULL) /* allocate the context */
     {
       fprintf (stdout, "unable to allocate context!\n");
@@ -199,6 +1198,27 @@ main (int argc, char *argv[])
       return (EXIT_FAILURE);
     }
 
+  if ((conventions = cnvalloc ()) == NULL) /* allocate the conventions */
+    {
+      fprintf (stdout, "unable to allocate conventions!\n");
+
+      return (EXIT_FAILURE);
+    }
+
+  if ((evaluator = evlalloc ()) == NULL) /* allocate the evaluator */
+    {
+      fprintf (stdout, "unable to allocate evaluator!\n");
+
+      return (EXIT_FAILURE);
+    }
+
+  if ((instances = genalloc ()) == NULL) /* allocate the instances */
+    {
+      fprintf (stdout, "unable to allocate instances!\n");
+
+      return (EXIT_FAILURE);
+    }
+
   if (argc == 1)
     {
       while (yyparse () != 0)
@@ -220,6 +1240,11 @@ main (int argc, char *argv[])
             }
 
           ctxreset (context); /* reset the context */
+          cnvreset (conventions);
+          evlreset (evaluator);
+          genreset (instances);
+
+          quoted = NULL; /* of the evaluator reset */
 
           while (yyparse () != 0)
             ;
@@ -229,6 +1254,11 @@ main (int argc, char *argv[])
         }
     }
   
+  free (called);
+  free (quote);
+  genfree (instances); /* free the instances */
+  evlfree (evaluator); /* free the evaluator */
+  cnvfree (conventions); /* free the conventions */
   ctxfree (context); /* free the context */
 
   return (EXIT_SUCCESS);
@@ -0,0 +1,642 @@
+/*****************************************************************************
+*                   Copyright (c) 2020-2021 Jack C. Lloyd.                   *
+*                            All rights reserved.                            *
+*****************************************************************************/
+
+#include "../include/atomic.h"
+#include "../include/context.h"
+#include "../include/image.h"
+#include "../include/procedure.h"
+
+/*****************************************************************************
+*                              Standard Library                              *
+*****************************************************************************/
+
+#include <stdlib.h>
+
+/*****************************************************************************
+*                                 Data Types                                 *
+*****************************************************************************/
+
+#define TABLE_LENGTH (16) /**< The length of the first chunk of a table. */
+#define TABLE_CHUNKS (32) /**< The most chunks, each twice the last. */
+
+/**
+ * A version data structure, implemented as a linked list, holding one
+ * compilation of a procedure. Its count is atomic, as frames of any thread
+ * pin it: acquired by prcenter(), and released by prcleave(), such that a
+ * version polled as of no frames is no longer read by any.
+ */
+struct version
+{
+  struct version *tail;    /**< The next (older) version in the list. */
+  procedure_t entry;       /**< The entry point. */
+  unsigned long long hash; /**< The hash of the source. */
+  struct image *image;     /**< The image holding the entry point, if any. */
+  atmnatural64_t count;    /**< The number of frames running the version. */
+};
+
+/**
+ * A slot data structure, holding every live version of a procedure. Its
+ * current version is published by prcpoll() and its pending version by
+ * prcswap(), thus a version is read whole by the thread entering or polling
+ * it. A thread is entering from before it reads the current version until it
+ * has pinned it, thus a version retired while none is entering is pinned by
+ * every frame that will ever run it.
+ */
+struct slot
+{
+  atmpointer_t current;    /**< The version entered by new frames. */
+  atmpointer_t pending;    /**< The version to swap in, if any. */
+  struct version *retired; /**< The old versions with frames still active. */
+  atmnatural64_t entering; /**< The threads entering the procedure. */
+};
+
+/**
+ * A table data structure, containing slots, named by a context. Its slots
+ * are held in chunks, each allocated as the last fills and never moved, thus
+ * a slot entered by one thread lives while another defines a procedure; its
+ * size is published once the slot it counts is, thus atomic.
+ */
+struct table
+{
+  struct context *names;              /**< The slot of each name. */
+  struct slot *chunks[TABLE_CHUNKS];  /**< The chunks of slots. */
+  atmnatural64_t size;                /**< The slots defined. */
+  size_t length;                      /**< The slots allocated. */
+};
+
+/**
+ * Allocate a version.
+ *
+ * @param entry The entry point.
+ * @param hash  The hash of the source.
+ * @param image The image holding the entry point, if any.
+ * @return      An initialised version on success, otherwise a null-pointer.
+ */
+static struct version *
+prcversion (procedure_t entry, unsigned long long hash, struct image *image)
+{
+  struct version *version = (struct version *) malloc (sizeof (struct version));
+
+  if (version == NULL)
+    {
+      return (NULL);
+    }
+
+  version->tail  = NULL;
+  version->entry = entry;
+  version->hash  = hash;
+  version->image = image;
+  version->count = 0;
+
+  return (version);
+}
+
+/**
+ * Release a list of versions.
+ *
+ * @param version The head of the list.
+ */
+static void
+prcrelease (struct version *version)
+{
+  while (version != NULL)
+    {
+      struct version *tail = version->tail;
+
+      imgfree (version->image);
+      free (version);
+
+      version = tail;
+    }
+}
+
+/**
+ * The slot of an index, within the chunk of TABLE_LENGTH << k slots holding
+ * it, i.e. that of the k for which said index is below TABLE_LENGTH times
+ * 2^(k + 1) - 1.
+ *
+ * @param table The table.
+ * @param index The index of the slot, allocated.
+ * @return      Said slot.
+ */
+static struct slot *
+prcslot (struct table *table, size_t index)
+{
+  size_t chunk = 0;
+  size_t first = 0; /* the index of the first slot of said chunk */
+
+  while (index - first >= (size_t) TABLE_LENGTH << chunk)
+    {
+      first += (size_t) TABLE_LENGTH << chunk;
+      chunk++;
+    }
+
+  return (&(table->chunks[chunk][index - first]));
+}
+
+/**
+ * Search a table for the slot of a name.
+ *
+ * @param table The table to search through.
+ * @param name  The name of the procedure.
+ * @return      The slot on success, otherwise a null-pointer.
+ */
+static struct slot *
+prcsearch (struct table *table, char const *name)
+{
+  int index;
+
+  if (table == NULL || ctxsearch (table->names, name, &index) != EXIT_SUCCESS)
+    {
+      return (NULL);
+    }
+
+  return (prcslot (table, (size_t) index));
+}
+
+/*****************************************************************************
+*                                   Tables                                   *
+*****************************************************************************/
+
+/**
+ * Allocate a table.
+ *
+ * @return An initialised table on success, otherwise a null-pointer.
+ * @see    prcfree().
+ */
+struct table *
+prcalloc (void)
+{
+  struct table *table = (struct table *) malloc (sizeof (struct table));
+
+  if (table == NULL)
+    {
+      return (NULL);
+    }
+
+  table->names  = ctxalloc ();
+  table->length = 0;
+
+  atmnatural64store (&table->size, 0, ATOMIC_RELAXED);
+
+  for (size_t i = 0; i < TABLE_CHUNKS; i++)
+    {
+      table->chunks[i] = NULL;
+    }
+
+  if (table->names == NULL)
+    {
+      free (table);
+
+      return (NULL);
+    }
+
+  return (table);
+}
+
+/**
+ * Free a table, along with every version of every procedure.
+ *
+ * @param table The table to free.
+ * @see         prcalloc().
+ */
+void
+prcfree (struct table *table)
+{
+  if (table == NULL)
+    {
+      return;
+    }
+
+  size_t const size = atmnatural64load (&table->size, ATOMIC_ACQUIRE);
+
+  for (size_t i = 0; i < size; i++)
+    {
+      struct slot *slot = prcslot (table, i);
+
+      prcrelease (atmpointerload (&slot->current, ATOMIC_ACQUIRE));
+      prcrelease (atmpointerload (&slot->pending, ATOMIC_ACQUIRE));
+      prcrelease (slot->retired);
+    }
+
+  for (size_t i = 0; i < TABLE_CHUNKS; i++)
+    {
+      free (table->chunks[i]);
+    }
+
+  ctxfree (table->names);
+  free (table);
+}
+
+/**
+ * Define a procedure in a table.
+ *
+ * @param table The table to define the procedure in.
+ * @param name  The name of the procedure.
+ * @param entry The entry point of the procedure.
+ * @param hash  The hash of the procedure's source, from cchhash().
+ * @param image The image holding said entry point, released alongside the
+ *              version, or a null-pointer.
+ * @param slot  A pointer to the slot of said procedure.
+ * @return      Zero on success, otherwise an error code.
+ * @see         prcswap() and prcstale().
+ */
+int
+prcdefine (struct table *table, char const *name, procedure_t entry,
+           unsigned long long hash, struct image *image, size_t *slot)
+{
+  if (table == NULL || name == NULL || entry == NULL || slot == NULL)
+    {
+      return (EXIT_NULLPTR);
+    }
+
+  size_t const size = atmnatural64load (&table->size, ATOMIC_RELAXED);
+
+  if (size >= table->length) /* a chunk more, leaving those before */
+    {
+      size_t chunk = 0;
+
+      while (chunk < TABLE_CHUNKS && table->chunks[chunk] != NULL)
+        {
+          chunk++;
+        }
+
+      if (chunk >= TABLE_CHUNKS)
+        {
+          return (EXIT_MAXIMISED);
+        }
+
+      size_t const length = (size_t) TABLE_LENGTH << chunk;
+
+      table->chunks[chunk] = (struct slot *) malloc (length
+                                                     * sizeof (struct slot));
+
+      if (table->chunks[chunk] == NULL)
+        {
+          return (EXIT_MALLOC);
+        }
+
+      table->length += length;
+    }
+
+  struct version *version = prcversion (entry, hash, image);
+
+  if (version == NULL)
+    {
+      return (EXIT_MALLOC);
+    }
+
+  int error = ctxinsert (table->names, name, (int) size);
+
+  if (error != EXIT_SUCCESS)
+    {
+      version->image = NULL;
+      prcrelease (version);
+
+      return (error);
+    }
+
+  struct slot *defined = prcslot (table, size);
+
+  atmpointerstore (&defined->current, version, ATOMIC_RELAXED);
+  atmpointerstore (&defined->pending, NULL, ATOMIC_RELAXED);
+  defined->retired = NULL;
+  atmnatural64store (&defined->entering, 0, ATOMIC_RELAXED);
+
+  /* publish said slot, whole, to the threads entering it */
+
+  atmnatural64store (&table->size, size + 1, ATOMIC_RELEASE);
+
+  *slot = size;
+
+  return (EXIT_SUCCESS);
+}
+
+/*****************************************************************************
+*                               Enter and Leave                              *
+*****************************************************************************/
+
+/**
+ * Enter a procedure, pinning its current version until the frame leaves.
+ *
+ * @param table   The table holding the procedure.
+ * @param slot    The slot of said procedure.
+ * @param version A pointer to the version entered, for prcleave().
+ * @return        The entry point on success, otherwise a null-pointer.
+ * @see           prcleave().
+ */
+procedure_t
+prcenter (struct table *table, size_t slot, struct version **version)
+{
+  if (table == NULL || version == NULL
+      || slot >= atmnatural64load (&table->size, ATOMIC_ACQUIRE))
+    {
+      return (NULL);
+    }
+
+  struct slot *entered = prcslot (table, slot);
+
+  atmnatural64add (&entered->entering, 1, ATOMIC_SEQ_CST);
+
+  *version = atmpointerload (&entered->current, ATOMIC_SEQ_CST);
+  atmnatural64add (&(*version)->count, 1, ATOMIC_ACQUIRE);
+
+  atmnatural64sub (&entered->entering, 1, ATOMIC_RELEASE);
+
+  return ((*version)->entry);
+}
+
+/**
+ * Leave a procedure, unpinning the version that was entered.
+ *
+ * @param version The version entered, from prcenter().
+ * @see           prcenter().
+ */
+void
+prcleave (struct version *version)
+{
+  if (version != NULL)
+    {
+      atmnatural64sub (&version->count, 1, ATOMIC_RELEASE);
+    }
+}
+
+/*****************************************************************************
+*                               Indirect Calls                               *
+*****************************************************************************/
+
+/**
+ * Initialise a call site.
+ *
+ * @param site The site to initialise.
+ * @see        prcindirect().
+ */
+void
+prcsite (struct site *site)
+{
+  if (site == NULL)
+    {
+      return;
+    }
+
+  for (size_t i = 0; i < SITE_LENGTH; i++)
+    {
+      atmnatural64store (&site->slots[i], 0, ATOMIC_RELAXED);
+      atmnatural64store (&site->counts[i], 0, ATOMIC_RELAXED);
+    }
+
+  atmnatural64store (&site->misses, 0, ATOMIC_RELAXED);
+}
+
+/**
+ * Enter a procedure through a procedure value, recording its target; a site
+ * may be entered by several threads at once.
+ *
+ * @param table   The table holding the procedure.
+ * @param site    The site of the call.
+ * @param slot    The slot of said procedure, being said value.
+ * @param version A pointer to the version entered, for prcleave().
+ * @return        The entry point on success, otherwise a null-pointer.
+ * @see           prcenter() and prcspeculate().
+ */
+procedure_t
+prcindirect (struct table *table, struct site *site, size_t slot,
+             struct version **version)
+{
+  if (site == NULL)
+    {
+      return (NULL);
+    }
+
+  natural64_t const target = (natural64_t) slot + 1; /* zero if unclaimed */
+
+  size_t i = 0;
+
+  for ( ; i < SITE_LENGTH; i++)
+    {
+      natural64_t claimed = atmnatural64load (&site->slots[i],
+                                              ATOMIC_RELAXED);
+
+      /* an entry is claimed by a single thread, another claiming it at once
+         reading the target claimed, to which it counts if its own */
+
+      if (claimed == 0
+          && atmnatural64cas (&site->slots[i], &claimed, target,
+                              ATOMIC_RELAXED, ATOMIC_RELAXED))
+        {
+          claimed = target;
+        }
+
+      if (claimed == target)
+        {
+          atmnatural64add (&site->counts[i], 1, ATOMIC_RELAXED);
+          break;
+        }
+    }
+
+  if (i == SITE_LENGTH)
+    {
+      atmnatural64add (&site->misses, 1, ATOMIC_RELAXED);
+    }
+
+  return (prcenter (table, slot, version));
+}
+
+/**
+ * Whether a site is monomorphic: having seen SITE_WARMUP calls, of which
+ * all but 1 / SITE_SPECULATE were to a single target. The counts are read
+ * while yet being added to, thus the answer is a hint, which the guard of
+ * a speculated call checks.
+ *
+ * @param site The site.
+ * @param slot A pointer to the slot of said target.
+ * @return     Zero if so, otherwise EXIT_UNDEFINED.
+ * @see        prcindirect().
+ */
+int
+prcspeculate (struct site *site, size_t *slot)
+{
+  if (site == NULL || slot == NULL)
+    {
+      return (EXIT_NULLPTR);
+    }
+
+  natural64_t total = atmnatural64load (&site->misses, ATOMIC_RELAXED);
+  natural64_t hottest = 0;
+  natural64_t target = 0;
+
+  for (size_t i = 0; i < SITE_LENGTH; i++)
+    {
+      natural64_t const count = atmnatural64load (&site->counts[i],
+                                                  ATOMIC_RELAXED);
+
+      total += count;
+
+      if (count > hottest)
+        {
+          hottest = count;
+          target  = atmnatural64load (&site->slots[i], ATOMIC_RELAXED);
+        }
+    }
+
+  if (total < SITE_WARMUP || target == 0
+      || (total - hottest) * SITE_SPECULATE > total)
+    {
+      return (EXIT_UNDEFINED);
+    }
+
+  *slot = (size_t) (target - 1);
+
+  return (EXIT_SUCCESS);
+}
+
+/*****************************************************************************
+*                            Stale, Swap, and Poll                           *
+*****************************************************************************/
+
+/**
+ * Whether a procedure's source differs from that of its newest version.
+ *
+ * @param table The table holding the procedure.
+ * @param name  The name of the procedure.
+ * @param hash  The hash of the procedure's updated source.
+ * @return      One if stale, zero if not, otherwise an error code.
+ * @see         prcswap().
+ */
+int
+prcstale (struct table *table, char const *name, unsigned long long hash)
+{
+  if (table == NULL || name == NULL)
+    {
+      return (EXIT_NULLPTR);
+    }
+
+  struct slot *slot = prcsearch (table, name);
+
+  if (slot == NULL)
+    {
+      return (EXIT_UNDEFINED);
+    }
+
+  struct version *newest = atmpointerload (&slot->pending, ATOMIC_ACQUIRE);
+
+  if (newest == NULL)
+    {
+      newest = atmpointerload (&slot->current, ATOMIC_ACQUIRE);
+    }
+
+  return (newest->hash != hash);
+}
+
+/**
+ * Swap a procedure, recompiled from updated source, into a table at the next
+ * safe point; replaces any swap already pending for said procedure.
+ *
+ * @param table The table holding the procedure.
+ * @param name  The name of the procedure.
+ * @param entry The new entry point of the procedure.
+ * @param hash  The hash of the procedure's updated source.
+ * @param image The image holding said entry point, or a null-pointer.
+ * @return      Zero on success, otherwise an error code.
+ * @see         prcstale() and prcpoll().
+ */
+int
+prcswap (struct table *table, char const *name, procedure_t entry,
+         unsigned long long hash, struct image *image)
+{
+  if (table == NULL || name == NULL || entry == NULL)
+    {
+      return (EXIT_NULLPTR);
+    }
+
+  struct slot *slot = prcsearch (table, name);
+
+  if (slot == NULL)
+    {
+      return (EXIT_UNDEFINED);
+    }
+
+  struct version *version = prcversion (entry, hash, image);
+
+  if (version == NULL)
+    {
+      return (EXIT_MALLOC);
+    }
+
+  /* the version replaced, if any, was never entered, thus is ours alone */
+
+  prcrelease (atmpointerexchange (&slot->pending, version, ATOMIC_ACQ_REL));
+
+  return (EXIT_SUCCESS);
+}
+
+/**
+ * Poll a table at a safe point, applying every pending swap and releasing
+ * every old version without active frames.
+ *
+ * @param table The table to poll.
+ * @return      The number of swaps applied.
+ * @see         prcswap().
+ */
+size_t
+prcpoll (struct table *table)
+{
+  if (table == NULL)
+    {
+      return (0);
+    }
+
+  size_t const size = atmnatural64load (&table->size, ATOMIC_RELAXED);
+
+  size_t count = 0;
+
+  for (size_t i = 0; i < size; i++)
+    {
+      struct slot *slot = prcslot (table, i);
+
+      struct version *pending = atmpointerexchange (&slot->pending, NULL,
+                                                    ATOMIC_ACQUIRE);
+
+      if (pending != NULL)
+        {
+          struct version *current = atmpointerload (&slot->current,
+                                                    ATOMIC_RELAXED);
+
+          current->tail = slot->retired;
+          slot->retired = current;
+
+          atmpointerstore (&slot->current, pending, ATOMIC_SEQ_CST);
+
+          count++;
+        }
+
+      /* a thread entering may yet pin a version just retired; those retired
+         are thus left to a later poll */
+
+      if (atmnatural64load (&slot->entering, ATOMIC_SEQ_CST) > 0)
+        {
+          continue;
+        }
+
+      for (struct version **it = &(slot->retired); *it != NULL; )
+        {
+          if (atmnatural64load (&(*it)->count, ATOMIC_ACQUIRE) == 0)
+            {
+              struct version *version = *it;
+
+              *it = version->tail;
+              version->tail = NULL;
+
+              prcrelease (version);
+            }
+          else
+            {
+              it = &((*it)->tail);
+            }
+        }
+    }
+
+  return (count);
+}
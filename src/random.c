@@ -0,0 +1,452 @@
+/*****************************************************************************
+*                   Copyright (c) 2020-2021 Jack C. Lloyd.                   *
+*                            All rights reserved.                            *
+*****************************************************************************/
+
+#include "../include/context.h"
+#include "../include/random.h"
+#include "../include/vector.h"
+
+/*****************************************************************************
+*                              Standard Library                              *
+*****************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+
+/*****************************************************************************
+*                                 Data Types                                 *
+*****************************************************************************/
+
+#define ONE_BITS ((natural64_t) 0x3ff0000000000000) /**< The bits of 1. */
+
+#if defined (__GNUC__) && defined (__SIZEOF_INT128__)
+#define RANDOM_WIDE (1)
+__extension__ typedef unsigned __int128 wide_t; /**< A natural of 128 bits. */
+#endif /* __GNUC__ */
+
+/**
+ * The polynomial of a jump of 2^128 numbers, as of a stream.
+ */
+static natural64_t const jumps[4] =
+{
+  0x180ec6d33cfd0aba, 0xd5a61266f0c9392c, 0xa9582618e03fc9aa,
+  0x39abdc4529b1661c,
+};
+
+/**
+ * The polynomial of a jump of 2^192 numbers, as of a generator.
+ */
+static natural64_t const longjumps[4] =
+{
+  0x76e15d3efefdcbbf, 0xc5004e441c522fb3, 0x77710069854ee241,
+  0x39109bb02acbe635,
+};
+
+/**
+ * Rotate a natural to the left.
+ *
+ * @param x     The natural.
+ * @param shift The bits by which to rotate it, within (0, 64).
+ * @return      Said natural rotated.
+ */
+static inline natural64_t
+rndrotate (natural64_t x, int shift)
+{
+  return ((x << shift) | (x >> (64 - shift)));
+}
+
+/**
+ * The next number of a stream of a generator.
+ *
+ * @param z    The generator.
+ * @param lane The stream.
+ * @return     Said number.
+ */
+static inline natural64_t
+rndnext (struct random *z, size_t lane)
+{
+  natural64_t (*s)[RANDOM_LANES] = z->state;
+
+  natural64_t const x = rndrotate (s[0][lane] + s[3][lane], 23) + s[0][lane];
+  natural64_t const t = s[1][lane] << 17;
+
+  s[2][lane] ^= s[0][lane];
+  s[3][lane] ^= s[1][lane];
+  s[1][lane] ^= s[2][lane];
+  s[0][lane] ^= s[3][lane];
+  s[2][lane] ^= t;
+  s[3][lane]  = rndrotate (s[3][lane], 45);
+
+  return (x);
+}
+
+/**
+ * The next numbers of every stream of a generator, one per lane.
+ *
+ * @param s The state of said generator, loaded, a word per vector.
+ * @return  Said numbers.
+ */
+static inline natural64x2_t
+rndvector (natural64x2_t *s)
+{
+  natural64x2_t const sum = natural64x2add (s[0], s[3]);
+
+  natural64x2_t const x
+    = natural64x2add (natural64x2or (natural64x2shl (sum,
+                                                     natural64x2splat (23)),
+                                     natural64x2shr (sum,
+                                                     natural64x2splat (41))),
+                      s[0]);
+
+  natural64x2_t const t = natural64x2shl (s[1], natural64x2splat (17));
+
+  s[2] = natural64x2xor (s[2], s[0]);
+  s[3] = natural64x2xor (s[3], s[1]);
+  s[1] = natural64x2xor (s[1], s[2]);
+  s[0] = natural64x2xor (s[0], s[3]);
+  s[2] = natural64x2xor (s[2], t);
+  s[3] = natural64x2or (natural64x2shl (s[3], natural64x2splat (45)),
+                        natural64x2shr (s[3], natural64x2splat (19)));
+
+  return (x);
+}
+
+/**
+ * Jump a stream of a generator ahead, by a polynomial thereof.
+ *
+ * @param z          The generator.
+ * @param lane       The stream.
+ * @param polynomial The polynomial, e.g. jumps.
+ */
+static void
+rndjump (struct random *z, size_t lane, natural64_t const *polynomial)
+{
+  natural64_t sum[4] = { 0, 0, 0, 0 };
+
+  for (int i = 0; i < 4; i++)
+    {
+      for (int bit = 0; bit < 64; bit++)
+        {
+          if (polynomial[i] & (natural64_t) 1 << bit)
+            {
+              for (int j = 0; j < 4; j++)
+                {
+                  sum[j] ^= z->state[j][lane];
+                }
+            }
+
+          rndnext (z, lane);
+        }
+    }
+
+  for (int j = 0; j < 4; j++)
+    {
+      z->state[j][lane] = sum[j];
+    }
+}
+
+/**
+ * Multiply two naturals, of a product of 128 bits.
+ *
+ * @param x    The multiplicand.
+ * @param y    The multiplier.
+ * @param high A pointer to the 64 most bits of said product.
+ * @return     The 64 least bits thereof.
+ */
+static inline natural64_t
+rndmultiply (natural64_t x, natural64_t y, natural64_t *high)
+{
+#ifdef RANDOM_WIDE
+  wide_t const product = (wide_t) x * y;
+
+  *high = (natural64_t) (product >> 64);
+
+  return ((natural64_t) product);
+#else
+  natural64_t const mask = 0xffffffff;
+
+  natural64_t const low    = (x & mask) * (y & mask);
+  natural64_t const cross  = (x >> 32) * (y & mask);
+  natural64_t const across = (x & mask) * (y >> 32);
+
+  natural64_t const middle = (low >> 32) + (cross & mask) + (across & mask);
+
+  *high = (x >> 32) * (y >> 32) + (cross >> 32) + (across >> 32)
+          + (middle >> 32);
+
+  return ((middle << 32) | (low & mask));
+#endif /* RANDOM_WIDE */
+}
+
+/**
+ * A real of a number, of its 52 most bits as the mantissa of [1, 2).
+ *
+ * @param x The number.
+ * @return  Said real, less one.
+ */
+static inline real_t
+rndmantissa (natural64_t x)
+{
+  natural64_t const bits = x >> 12 | ONE_BITS;
+
+  real_t z;
+
+  memcpy (&z, &bits, sizeof (z));
+
+  return (z - 1.0);
+}
+
+/*****************************************************************************
+*                                 Generators                                 *
+*****************************************************************************/
+
+/**
+ * Seed a generator, as by SplitMix64 of a seed, such that similar seeds are
+ * of dissimilar states.
+ *
+ * @param z    The generator to seed.
+ * @param seed The seed.
+ * @return     Zero on success, otherwise EXIT_NULLPTR.
+ * @see        rndstream().
+ */
+int
+rndseed (struct random *z, natural64_t seed)
+{
+  if (z == NULL)
+    {
+      return (EXIT_NULLPTR);
+    }
+
+  for (int i = 0; i < 4; i++)
+    {
+      natural64_t x = (seed += 0x9e3779b97f4a7c15);
+
+      x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9;
+      x = (x ^ (x >> 27)) * 0x94d049bb133111eb;
+
+      z->state[i][0] = x ^ (x >> 31);
+    }
+
+  /* each stream is that before, jumped */
+
+  for (size_t lane = 1; lane < RANDOM_LANES; lane++)
+    {
+      for (int i = 0; i < 4; i++)
+        {
+          z->state[i][lane] = z->state[i][lane - 1];
+        }
+
+      rndjump (z, lane, jumps);
+    }
+
+  return (EXIT_SUCCESS);
+}
+
+/**
+ * Derive an independent generator from another, e.g. one per thread.
+ *
+ * @param z     The generator to derive.
+ * @param base  The generator from which to derive it, as seeded.
+ * @param index The index of said generator, e.g. its chunk; that of zero is
+ *              but a copy of the base.
+ * @return      Zero on success, otherwise EXIT_NULLPTR.
+ * @see         rndseed().
+ */
+int
+rndstream (struct random *z, struct random const *base, size_t index)
+{
+  if (z == NULL || base == NULL)
+    {
+      return (EXIT_NULLPTR);
+    }
+
+  *z = *base;
+
+  for (size_t i = 0; i < index; i++)
+    {
+      for (size_t lane = 0; lane < RANDOM_LANES; lane++)
+        {
+          rndjump (z, lane, longjumps);
+        }
+    }
+
+  return (EXIT_SUCCESS);
+}
+
+/*****************************************************************************
+*                                  Numbers                                   *
+*****************************************************************************/
+
+/**
+ * A natural, uniform over every natural of 64 bits.
+ *
+ * @param z The generator.
+ * @return  Said natural.
+ */
+natural64_t
+rndnatural (struct random *z)
+{
+  return (rndnext (z, 0));
+}
+
+/**
+ * A natural below a bound, unbiased.
+ *
+ * @param z     The generator.
+ * @param bound The bound, zero of every natural of 64 bits.
+ * @return      Said natural.
+ */
+natural64_t
+rndbounded (struct random *z, natural64_t bound)
+{
+  if (bound == 0)
+    {
+      return (rndnext (z, 0));
+    }
+
+  /* the 64 most bits of x bound, but for the 2^64 mod bound least rejected */
+
+  natural64_t high;
+  natural64_t low = rndmultiply (rndnext (z, 0), bound, &high);
+
+  if (low < bound)
+    {
+      natural64_t const threshold = (0 - bound) % bound;
+
+      while (low < threshold)
+        {
+          low = rndmultiply (rndnext (z, 0), bound, &high);
+        }
+    }
+
+  return (high);
+}
+
+/**
+ * A real, uniform over [0, 1).
+ *
+ * @param z The generator.
+ * @return  Said real.
+ */
+real_t
+rndreal (struct random *z)
+{
+  return (rndmantissa (rndnext (z, 0)));
+}
+
+/**
+ * A real, uniform over [low, high).
+ *
+ * @param z    The generator.
+ * @param low  The least real.
+ * @param high The real above the greatest.
+ * @return     Said real.
+ */
+real_t
+rnduniform (struct random *z, real_t low, real_t high)
+{
+  real_t const x = low + (high - low) * rndmantissa (rndnext (z, 0));
+
+  return (x < high ? x : low); /* as rounded up to the bound */
+}
+
+/*****************************************************************************
+*                                   Arrays                                   *
+*****************************************************************************/
+
+/**
+ * Fill an array with naturals, as of rndnatural().
+ *
+ * @param z      The generator.
+ * @param array  The array.
+ * @param length The length thereof.
+ * @return       Zero on success, otherwise EXIT_NULLPTR.
+ */
+int
+rndfill (struct random *z, natural64_t *array, size_t length)
+{
+  if (z == NULL || (array == NULL && length > 0))
+    {
+      return (EXIT_NULLPTR);
+    }
+
+  natural64x2_t s[4];
+
+  for (int i = 0; i < 4; i++)
+    {
+      s[i] = natural64x2load (z->state[i]);
+    }
+
+  size_t i = 0;
+
+  for ( ; i + RANDOM_LANES <= length; i += RANDOM_LANES)
+    {
+      natural64x2store (array + i, rndvector (s));
+    }
+
+  for (int j = 0; j < 4; j++)
+    {
+      natural64x2store (z->state[j], s[j]);
+    }
+
+  for ( ; i < length; i++)
+    {
+      array[i] = rndnext (z, 0);
+    }
+
+  return (EXIT_SUCCESS);
+}
+
+/**
+ * Fill an array with reals, as of rndreal().
+ *
+ * @param z      The generator.
+ * @param array  The array.
+ * @param length The length thereof.
+ * @return       Zero on success, otherwise EXIT_NULLPTR.
+ */
+int
+rndfillreal (struct random *z, real_t *array, size_t length)
+{
+  if (z == NULL || (array == NULL && length > 0))
+    {
+      return (EXIT_NULLPTR);
+    }
+
+  natural64x2_t const one = natural64x2splat (ONE_BITS);
+
+  natural64x2_t s[4];
+
+  for (int i = 0; i < 4; i++)
+    {
+      s[i] = natural64x2load (z->state[i]);
+    }
+
+  size_t i = 0;
+
+  for ( ; i + RANDOM_LANES <= length; i += RANDOM_LANES)
+    {
+      natural64x2_t const bits
+        = natural64x2or (natural64x2shr (rndvector (s), natural64x2splat (12)),
+                         one);
+
+      real64x2_t x;
+
+      memcpy (&x, &bits, sizeof (x));
+
+      real64x2store (array + i, real64x2sub (x, real64x2splat (1.0)));
+    }
+
+  for (int j = 0; j < 4; j++)
+    {
+      natural64x2store (z->state[j], s[j]);
+    }
+
+  for ( ; i < length; i++)
+    {
+      array[i] = rndmantissa (rndnext (z, 0));
+    }
+
+  return (EXIT_SUCCESS);
+}
@@ -0,0 +1,389 @@
+/*****************************************************************************
+*                   Copyright (c) 2020-2021 Jack C. Lloyd.                   *
+*                            All rights reserved.                            *
+*****************************************************************************/
+
+#include "../include/context.h"
+#include "../include/range.h"
+
+/*****************************************************************************
+*                              Standard Library                              *
+*****************************************************************************/
+
+#include <errno.h>
+#include <limits.h>
+#include <stdlib.h>
+
+/*****************************************************************************
+*                                 Data Types                                 *
+*****************************************************************************/
+
+#define RANGE_LIMIT (LLONG_MAX) /**< Every bound beyond it saturates to it. */
+
+#define MINIMUM(x, y) ((x) < (y) ? (x) : (y))
+#define MAXIMUM(x, y) ((x) > (y) ? (x) : (y))
+
+/**
+ * The kind of an operation.
+ *
+ * @param x The range of the first operand.
+ * @param y The range of the second operand.
+ * @return  RANGE_NONE if either is unknown, RANGE_INTEGER if either is an
+ *          integer, otherwise RANGE_NATURAL; RANGE_WIDE if either is.
+ */
+static int
+rngkind (struct range const *x, struct range const *y)
+{
+  if (x->kind == RANGE_NONE || y->kind == RANGE_NONE)
+    {
+      return (RANGE_NONE);
+    }
+
+  int const wide = (x->kind | y->kind) & RANGE_WIDE;
+
+  if ((x->kind | y->kind) & RANGE_INTEGER)
+    {
+      return (RANGE_INTEGER | wide);
+    }
+
+  return (RANGE_NATURAL | wide);
+}
+
+/**
+ * The sum of two bounds, saturating at RANGE_LIMIT.
+ *
+ * @param x The first bound.
+ * @param y The second bound.
+ * @return  The (saturated) sum.
+ */
+static long long
+rngsum (long long x, long long y)
+{
+  if (y > 0 ? x > RANGE_LIMIT - y : x < -RANGE_LIMIT - y)
+    {
+      return (y > 0 ? RANGE_LIMIT : -RANGE_LIMIT);
+    }
+
+  return (x + y);
+}
+
+/**
+ * The product of two bounds, saturating at RANGE_LIMIT.
+ *
+ * @param x The first bound.
+ * @param y The second bound.
+ * @return  The (saturated) product.
+ */
+static long long
+rngproduct (long long x, long long y)
+{
+  if (x == 0 || y == 0)
+    {
+      return (0);
+    }
+
+  if (llabs (x) > RANGE_LIMIT / llabs (y))
+    {
+      return ((x < 0) != (y < 0) ? -RANGE_LIMIT : RANGE_LIMIT);
+    }
+
+  return (x * y);
+}
+
+/**
+ * Fit the bounds of a result to its kind.
+ *
+ * @param z    The range of the result.
+ * @param kind The kind of said result.
+ * @param lo   The least value of said result, before fitting.
+ * @param hi   The greatest value of said result, before fitting.
+ * @return     See range.h.
+ */
+static int
+rngfit (struct range *z, int kind, long long lo, long long hi)
+{
+  if (kind == RANGE_NONE)
+    {
+      rngnone (z);
+
+      return (RANGE_CHECKED);
+    }
+
+  long long minimum = kind & RANGE_NATURAL ? (long long) NATURAL_MIN
+                                           : (long long) INTEGER_MIN;
+  long long maximum = kind & RANGE_NATURAL ? (long long) NATURAL_MAX
+                                           : (long long) INTEGER_MAX;
+
+  if (kind & RANGE_WIDE) /* those of 64 bits, as far as saturated */
+    {
+      minimum = kind & RANGE_NATURAL ? 0 : -RANGE_LIMIT;
+      maximum = RANGE_LIMIT;
+    }
+
+  z->kind = kind;
+
+  if (hi < minimum || lo > maximum)
+    {
+      z->minimum = minimum;
+      z->maximum = maximum;
+
+      return (EXIT_OVERFLOW);
+    }
+
+  z->minimum = MAXIMUM (lo, minimum);
+  z->maximum = MINIMUM (hi, maximum);
+
+  if (z->minimum <= -RANGE_LIMIT || z->maximum >= RANGE_LIMIT)
+    {
+      z->minimum = minimum; /* saturated, thus of no known bound */
+      z->maximum = maximum;
+
+      return (RANGE_CHECKED);
+    }
+
+  return (lo < minimum || hi > maximum ? RANGE_CHECKED : EXIT_SUCCESS);
+}
+
+/*****************************************************************************
+*                                   Ranges                                   *
+*****************************************************************************/
+
+/**
+ * The range of an expression of unknown bounds.
+ *
+ * @param range The range to fill in.
+ * @see         rngliteral().
+ */
+void
+rngnone (struct range *range)
+{
+  if (range == NULL)
+    {
+      return;
+    }
+
+  range->kind    = RANGE_NONE;
+  range->minimum = -RANGE_LIMIT;
+  range->maximum = RANGE_LIMIT;
+}
+
+/**
+ * The range of a literal.
+ *
+ * @param range   The range to fill in.
+ * @param kind    The kind of said literal.
+ * @param literal The text of said literal, unsigned.
+ * @return        Zero on success, otherwise EXIT_OVERFLOW if beyond 64 bits.
+ * @see           rngnone().
+ */
+int
+rngliteral (struct range *range, int kind, char const *literal)
+{
+  if (range == NULL || literal == NULL)
+    {
+      return (EXIT_NULLPTR);
+    }
+
+  if (kind == RANGE_NONE)
+    {
+      rngnone (range);
+
+      return (EXIT_SUCCESS);
+    }
+
+  errno = 0;
+
+  unsigned long long const value = strtoull (literal, NULL, 10);
+
+  if (errno == ERANGE
+      || ((kind & RANGE_INTEGER) && value > (unsigned long long) LLONG_MAX))
+    {
+      rngfit (range, kind | RANGE_WIDE, RANGE_LIMIT, RANGE_LIMIT);
+
+      return (EXIT_OVERFLOW);
+    }
+
+  long long const bound = value < (unsigned long long) RANGE_LIMIT
+                          ? (long long) value : RANGE_LIMIT;
+
+  /* of 64 bits if beyond those of 32, as is its type, see typfit () */
+
+  long long const maximum = kind & RANGE_NATURAL ? (long long) NATURAL_MAX
+                                                 : (long long) INTEGER_MAX;
+
+  int const wide = bound > maximum ? RANGE_WIDE : 0;
+
+  return (rngfit (range, kind | wide, bound, bound) == EXIT_OVERFLOW
+          ? EXIT_OVERFLOW : EXIT_SUCCESS);
+}
+
+/**
+ * The range of a variable, being every value of its type.
+ *
+ * @param range The range to fill in.
+ * @param kind  The kind of said variable, RANGE_NATURAL or RANGE_INTEGER.
+ * @param width The width of its type, in bytes, e.g. one of a natural8.
+ * @see         rngnone().
+ */
+void
+rngwidth (struct range *range, int kind, int width)
+{
+  if (range == NULL)
+    {
+      return;
+    }
+
+  if (kind == RANGE_NONE || width < 1 || width > 8)
+    {
+      rngnone (range);
+
+      return;
+    }
+
+  if (width == 8) /* as far as saturated, thus of unknown bounds */
+    {
+      range->kind    = kind | RANGE_WIDE;
+      range->minimum = kind & RANGE_NATURAL ? 0 : -RANGE_LIMIT;
+      range->maximum = RANGE_LIMIT;
+
+      return;
+    }
+
+  int const bits = 8 * width;
+
+  range->kind    = kind;
+  range->minimum = kind & RANGE_NATURAL ? 0 : -(1LL << (bits - 1));
+  range->maximum = kind & RANGE_NATURAL ? (1LL << bits) - 1
+                                        : (1LL << (bits - 1)) - 1;
+}
+
+/**
+ * The range of a sum.
+ *
+ * @param z The range of the sum.
+ * @param x The range of the augend.
+ * @param y The range of the addend.
+ * @return  See range.h.
+ */
+int
+rngadd (struct range *z, struct range const *x, struct range const *y)
+{
+  return (rngfit (z, rngkind (x, y), rngsum (x->minimum, y->minimum),
+                                     rngsum (x->maximum, y->maximum)));
+}
+
+/**
+ * The range of a difference.
+ *
+ * @param z The range of the difference.
+ * @param x The range of the minuend.
+ * @param y The range of the subtrahend.
+ * @return  See range.h.
+ */
+int
+rngsub (struct range *z, struct range const *x, struct range const *y)
+{
+  return (rngfit (z, rngkind (x, y), rngsum (x->minimum, -y->maximum),
+                                     rngsum (x->maximum, -y->minimum)));
+}
+
+/**
+ * The range of a product.
+ *
+ * @param z The range of the product.
+ * @param x The range of the multiplicand.
+ * @param y The range of the multiplier.
+ * @return  See range.h.
+ */
+int
+rngmul (struct range *z, struct range const *x, struct range const *y)
+{
+  long long const a = rngproduct (x->minimum, y->minimum);
+  long long const b = rngproduct (x->minimum, y->maximum);
+  long long const c = rngproduct (x->maximum, y->minimum);
+  long long const d = rngproduct (x->maximum, y->maximum);
+
+  return (rngfit (z, rngkind (x, y), MINIMUM (MINIMUM (a, b), MINIMUM (c, d)),
+                                     MAXIMUM (MAXIMUM (a, b), MAXIMUM (c, d))));
+}
+
+/**
+ * The range of a quotient.
+ *
+ * @param z The range of the quotient.
+ * @param x The range of the dividend.
+ * @param y The range of the divisor.
+ * @return  See range.h.
+ */
+int
+rngdiv (struct range *z, struct range const *x, struct range const *y)
+{
+  int const kind = rngkind (x, y);
+
+  if (kind != RANGE_NONE && y->minimum == 0 && y->maximum == 0)
+    {
+      rngfit (z, kind, 0, 0);
+
+      return (EXIT_UNDEFINED);
+    }
+
+  if (y->minimum <= 0 && y->maximum >= 0) /* may divide by zero */
+    {
+      long long const m = MAXIMUM (llabs (x->minimum), llabs (x->maximum));
+
+      rngfit (z, kind, kind & RANGE_NATURAL ? 0 : -m, m);
+
+      return (RANGE_CHECKED);
+    }
+
+  /* truncating division is monotonic in each operand, as the divisor's sign
+     is fixed, thus the bounds lie at the corners */
+
+  long long const a = x->minimum / y->minimum;
+  long long const b = x->minimum / y->maximum;
+  long long const c = x->maximum / y->minimum;
+  long long const d = x->maximum / y->maximum;
+
+  return (rngfit (z, kind, MINIMUM (MINIMUM (a, b), MINIMUM (c, d)),
+                           MAXIMUM (MAXIMUM (a, b), MAXIMUM (c, d))));
+}
+
+/**
+ * The range of a remainder.
+ *
+ * @param z The range of the remainder.
+ * @param x The range of the dividend.
+ * @param y The range of the divisor.
+ * @return  See range.h.
+ */
+int
+rngmod (struct range *z, struct range const *x, struct range const *y)
+{
+  int const kind = rngkind (x, y);
+
+  if (kind != RANGE_NONE && y->minimum == 0 && y->maximum == 0)
+    {
+      rngfit (z, kind, 0, 0);
+
+      return (EXIT_UNDEFINED);
+    }
+
+  if (x->minimum == x->maximum && y->minimum == y->maximum)
+    {
+      long long const r = y->minimum == -1 ? 0 : x->minimum % y->minimum;
+
+      return (rngfit (z, kind, r, r));
+    }
+
+  /* the remainder takes the sign of the dividend, and is smaller in
+     magnitude than both the dividend and the divisor */
+
+  long long const m = MAXIMUM (llabs (y->minimum), llabs (y->maximum)) - 1;
+
+  long long const lo = x->minimum < 0 ? -MINIMUM (m, llabs (x->minimum)) : 0;
+  long long const hi = x->maximum > 0 ?  MINIMUM (m, x->maximum) : 0;
+
+  int const result = rngfit (z, kind, lo, hi);
+
+  return (y->minimum <= 0 && y->maximum >= 0 ? RANGE_CHECKED : result);
+}
@@ -0,0 +1,680 @@
+/*****************************************************************************
+*                   Copyright (c) 2020-2021 Jack C. Lloyd.                   *
+*                            All rights reserved.                            *
+*****************************************************************************/
+
+#include "../include/context.h"
+#include "../include/sort.h"
+
+/*****************************************************************************
+*                              Standard Library                              *
+*****************************************************************************/
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*****************************************************************************
+*                                 Data Types                                 *
+*****************************************************************************/
+
+#define SORT_INSERTION (24)   /**< The longest array sorted by insertion. */
+#define SORT_NINTHER   (128)  /**< The shortest pivoted by a ninther. */
+#define SORT_MOVES     (8)    /**< The most moves of a partial insertion. */
+#define SORT_RADIX     (1024) /**< The shortest array sorted by radix. */
+
+/** The sign bit of an unsigned type. */
+#define SORT_SIGN(word) ((word) ((word) 1 << (8 * sizeof (word) - 1)))
+
+/** Swap two lvalues of a type. */
+#define SORT_SWAP(type, x, y)                                                 \
+  do                                                                          \
+    {                                                                         \
+      type const swap = (x);                                                  \
+                                                                              \
+      (x) = (y);                                                              \
+      (y) = swap;                                                             \
+    }                                                                         \
+  while (0)
+
+/**
+ * A part data structure, of strings sharing a prefix.
+ */
+struct part
+{
+  string_t *array; /**< The strings. */
+  size_t length;   /**< The number thereof. */
+  size_t depth;    /**< The length of said prefix. */
+};
+
+/**
+ * The base two logarithm of a length, rounded down; the bad partitions of
+ * pdqsort tolerated before it falls back to a heapsort.
+ *
+ * @param length The length.
+ * @return       Said logarithm.
+ */
+static int
+sortlog (size_t length)
+{
+  int log = 0;
+
+  while (length >>= 1)
+    {
+      log++;
+    }
+
+  return (log);
+}
+
+/*****************************************************************************
+*                                    Keys                                    *
+*****************************************************************************/
+
+/*
+ * The key of each element is an unsigned number of its width, ordered as is
+ * said element; the sorts below compare nothing but keys.
+ */
+
+#define SORT_NATURAL(name, type, word)                                        \
+  static inline word                                                          \
+  name##key (type x)                                                          \
+  {                                                                           \
+    return ((word) x);                                                        \
+  }
+
+#define SORT_INTEGER(name, type, word)                                        \
+  static inline word                                                          \
+  name##key (type x)                                                          \
+  {                                                                           \
+    return ((word) ((word) x ^ SORT_SIGN (word)));                            \
+  }
+
+#define SORT_REAL(name, type, word)                                           \
+  static inline word                                                          \
+  name##key (type x)                                                          \
+  {                                                                           \
+    word bits;                                                                \
+                                                                              \
+    memcpy (&bits, &x, sizeof (bits));                                        \
+                                                                              \
+    return ((word) (bits & SORT_SIGN (word) ? ~bits                           \
+                                            : bits | SORT_SIGN (word)));      \
+  }
+
+SORT_NATURAL (natural8,  natural8_t,  uint8_t)
+SORT_NATURAL (natural16, natural16_t, uint16_t)
+SORT_NATURAL (natural32, natural32_t, uint32_t)
+SORT_NATURAL (natural64, natural64_t, uint64_t)
+
+SORT_INTEGER (integer8,  integer8_t,  uint8_t)
+SORT_INTEGER (integer16, integer16_t, uint16_t)
+SORT_INTEGER (integer32, integer32_t, uint32_t)
+SORT_INTEGER (integer64, integer64_t, uint64_t)
+
+SORT_REAL (real32, real32_t, uint32_t)
+SORT_REAL (real64, real64_t, uint64_t)
+
+/*****************************************************************************
+*                                   Sorts                                    *
+*****************************************************************************/
+
+#define SORT_DEFINE(name, type)                                               \
+  static void                                                                 \
+  name##insertion (type *array, size_t length)                                \
+  {                                                                           \
+    for (size_t i = 1; i < length; i++)                                       \
+      {                                                                       \
+        type const x = array[i];                                              \
+                                                                              \
+        size_t j = i;                                                         \
+                                                                              \
+        for ( ; j > 0 && name##key (x) < name##key (array[j - 1]); j--)       \
+          {                                                                   \
+            array[j] = array[j - 1];                                          \
+          }                                                                   \
+                                                                              \
+        array[j] = x;                                                         \
+      }                                                                       \
+  }                                                                           \
+                                                                              \
+  static int                                                                  \
+  name##partial (type *array, size_t length)                                  \
+  {                                                                           \
+    size_t moves = 0;                                                         \
+                                                                              \
+    for (size_t i = 1; i < length; i++)                                       \
+      {                                                                       \
+        type const x = array[i];                                              \
+                                                                              \
+        size_t j = i;                                                         \
+                                                                              \
+        for ( ; j > 0 && name##key (x) < name##key (array[j - 1]); j--)       \
+          {                                                                   \
+            array[j] = array[j - 1];                                          \
+          }                                                                   \
+                                                                              \
+        array[j] = x;                                                         \
+        moves += i - j;                                                       \
+                                                                              \
+        if (moves > SORT_MOVES)                                               \
+          {                                                                   \
+            return (0);                                                       \
+          }                                                                   \
+      }                                                                       \
+                                                                              \
+    return (1);                                                               \
+  }                                                                           \
+                                                                              \
+  static void                                                                 \
+  name##sift (type *array, size_t length, size_t i)                           \
+  {                                                                           \
+    for (size_t child = 2 * i + 1; child < length; child = 2 * i + 1)         \
+      {                                                                       \
+        if (child + 1 < length                                                \
+            && name##key (array[child]) < name##key (array[child + 1]))       \
+          {                                                                   \
+            child++;                                                          \
+          }                                                                   \
+                                                                              \
+        if (!(name##key (array[i]) < name##key (array[child])))               \
+          {                                                                   \
+            break;                                                            \
+          }                                                                   \
+                                                                              \
+        SORT_SWAP (type, array[i], array[child]);                             \
+        i = child;                                                            \
+      }                                                                       \
+  }                                                                           \
+                                                                              \
+  static void                                                                 \
+  name##heap (type *array, size_t length)                                     \
+  {                                                                           \
+    for (size_t i = length / 2; i-- > 0; )                                    \
+      {                                                                       \
+        name##sift (array, length, i);                                        \
+      }                                                                       \
+                                                                              \
+    for (size_t end = length; end-- > 1; )                                    \
+      {                                                                       \
+        SORT_SWAP (type, array[0], array[end]);                               \
+        name##sift (array, end, 0);                                           \
+      }                                                                       \
+  }                                                                           \
+                                                                              \
+  static void                                                                 \
+  name##sort3 (type *array, size_t i, size_t j, size_t k)                     \
+  {                                                                           \
+    if (name##key (array[j]) < name##key (array[i]))                          \
+      {                                                                       \
+        SORT_SWAP (type, array[i], array[j]);                                 \
+      }                                                                       \
+                                                                              \
+    if (name##key (array[k]) < name##key (array[j]))                          \
+      {                                                                       \
+        SORT_SWAP (type, array[j], array[k]);                                 \
+                                                                              \
+        if (name##key (array[j]) < name##key (array[i]))                      \
+          {                                                                   \
+            SORT_SWAP (type, array[i], array[j]);                             \
+          }                                                                   \
+      }                                                                       \
+  }                                                                           \
+                                                                              \
+  static size_t                                                               \
+  name##right (type *array, size_t length, int *partitioned)                  \
+  {                                                                           \
+    type const pivot = array[0];                                              \
+                                                                              \
+    size_t first = 0;                                                         \
+    size_t last  = length;                                                    \
+                                                                              \
+    while (name##key (array[++first]) < name##key (pivot))                    \
+      ;                                                                       \
+                                                                              \
+    if (first == 1)                                                           \
+      {                                                                       \
+        while (first < last && !(name##key (array[--last])                    \
+                                 < name##key (pivot)))                        \
+          ;                                                                   \
+      }                                                                       \
+    else                                                                      \
+      {                                                                       \
+        while (!(name##key (array[--last]) < name##key (pivot)))              \
+          ;                                                                   \
+      }                                                                       \
+                                                                              \
+    *partitioned = first >= last;                                             \
+                                                                              \
+    while (first < last)                                                      \
+      {                                                                       \
+        SORT_SWAP (type, array[first], array[last]);                          \
+                                                                              \
+        while (name##key (array[++first]) < name##key (pivot))                \
+          ;                                                                   \
+                                                                              \
+        while (!(name##key (array[--last]) < name##key (pivot)))              \
+          ;                                                                   \
+      }                                                                       \
+                                                                              \
+    array[0]         = array[first - 1];                                      \
+    array[first - 1] = pivot;                                                 \
+                                                                              \
+    return (first - 1);                                                       \
+  }                                                                           \
+                                                                              \
+  static size_t                                                               \
+  name##left (type *array, size_t length)                                     \
+  {                                                                           \
+    type const pivot = array[0];                                              \
+                                                                              \
+    size_t first = 0;                                                         \
+    size_t last  = length;                                                    \
+                                                                              \
+    while (name##key (pivot) < name##key (array[--last]))                     \
+      ;                                                                       \
+                                                                              \
+    if (last + 1 == length)                                                   \
+      {                                                                       \
+        while (first < last && !(name##key (pivot)                            \
+                                 < name##key (array[++first])))               \
+          ;                                                                   \
+      }                                                                       \
+    else                                                                      \
+      {                                                                       \
+        while (!(name##key (pivot) < name##key (array[++first])))             \
+          ;                                                                   \
+      }                                                                       \
+                                                                              \
+    while (first < last)                                                      \
+      {                                                                       \
+        SORT_SWAP (type, array[first], array[last]);                          \
+                                                                              \
+        while (name##key (pivot) < name##key (array[--last]))                 \
+          ;                                                                   \
+                                                                              \
+        while (!(name##key (pivot) < name##key (array[++first])))             \
+          ;                                                                   \
+      }                                                                       \
+                                                                              \
+    array[0]    = array[last];                                                \
+    array[last] = pivot;                                                      \
+                                                                              \
+    return (last);                                                            \
+  }                                                                           \
+                                                                              \
+  static void                                                                 \
+  name##shuffle (type *array, size_t length)                                  \
+  {                                                                           \
+    size_t const quarter = length / 4;                                        \
+                                                                              \
+    SORT_SWAP (type, array[0], array[quarter]);                               \
+    SORT_SWAP (type, array[length - 1], array[length - quarter]);             \
+                                                                              \
+    if (length > SORT_NINTHER)                                                \
+      {                                                                       \
+        SORT_SWAP (type, array[1], array[quarter + 1]);                       \
+        SORT_SWAP (type, array[2], array[quarter + 2]);                       \
+        SORT_SWAP (type, array[length - 2], array[length - quarter - 1]);     \
+        SORT_SWAP (type, array[length - 3], array[length - quarter - 2]);     \
+      }                                                                       \
+  }                                                                           \
+                                                                              \
+  static void                                                                 \
+  name##pdq (type *array, size_t length, int bad, int leftmost)               \
+  {                                                                           \
+    while (length > SORT_INSERTION)                                           \
+      {                                                                       \
+        size_t const half = length / 2;                                       \
+                                                                              \
+        if (length > SORT_NINTHER)                                            \
+          {                                                                   \
+            name##sort3 (array, 0, half, length - 1);                         \
+            name##sort3 (array, 1, half - 1, length - 2);                     \
+            name##sort3 (array, 2, half + 1, length - 3);                     \
+            name##sort3 (array, half - 1, half, half + 1);                    \
+            SORT_SWAP (type, array[0], array[half]);                          \
+          }                                                                   \
+        else                                                                  \
+          {                                                                   \
+            name##sort3 (array, half, 0, length - 1);                         \
+          }                                                                   \
+                                                                              \
+        if (!leftmost && !(name##key (array[-1]) < name##key (array[0])))     \
+          {                                                                   \
+            size_t const pivot = name##left (array, length);                  \
+                                                                              \
+            array  += pivot + 1;                                              \
+            length -= pivot + 1;                                              \
+                                                                              \
+            continue;                                                         \
+          }                                                                   \
+                                                                              \
+        int partitioned;                                                      \
+                                                                              \
+        size_t const pivot = name##right (array, length, &partitioned);       \
+        size_t const right = length - pivot - 1;                              \
+                                                                              \
+        if (pivot < length / 8 || right < length / 8)                         \
+          {                                                                   \
+            if (--bad == 0)                                                   \
+              {                                                               \
+                name##heap (array, length);                                   \
+                                                                              \
+                return;                                                       \
+              }                                                               \
+                                                                              \
+            if (pivot >= SORT_INSERTION)                                      \
+              {                                                               \
+                name##shuffle (array, pivot);                                 \
+              }                                                               \
+                                                                              \
+            if (right >= SORT_INSERTION)                                      \
+              {                                                               \
+                name##shuffle (array + pivot + 1, right);                     \
+              }                                                               \
+          }                                                                   \
+        else if (partitioned && name##partial (array, pivot)                  \
+                 && name##partial (array + pivot + 1, right))                 \
+          {                                                                   \
+            return;                                                           \
+          }                                                                   \
+                                                                              \
+        if (pivot < right)                                                    \
+          {                                                                   \
+            name##pdq (array, pivot, bad, leftmost);                          \
+                                                                              \
+            array   += pivot + 1;                                             \
+            length   = right;                                                 \
+            leftmost = 0;                                                     \
+          }                                                                   \
+        else                                                                  \
+          {                                                                   \
+            name##pdq (array + pivot + 1, right, bad, 0);                     \
+                                                                              \
+            length = pivot;                                                   \
+          }                                                                   \
+      }                                                                       \
+                                                                              \
+    name##insertion (array, length);                                          \
+  }                                                                           \
+                                                                              \
+  static void                                                                 \
+  name##radix (type *array, type *buffer, size_t length)                      \
+  {                                                                           \
+    size_t counts[sizeof (type)][256] = { { 0 } };                            \
+                                                                              \
+    for (size_t i = 0; i < length; i++)                                       \
+      {                                                                       \
+        for (size_t byte = 0; byte < sizeof (type); byte++)                   \
+          {                                                                   \
+            counts[byte][(name##key (array[i]) >> 8 * byte) & 0xff]++;        \
+          }                                                                   \
+      }                                                                       \
+                                                                              \
+    type *from = array;                                                       \
+    type *to   = buffer;                                                      \
+                                                                              \
+    for (size_t byte = 0; byte < sizeof (type); byte++)                       \
+      {                                                                       \
+        size_t *count = counts[byte];                                         \
+                                                                              \
+        if (count[(name##key (from[0]) >> 8 * byte) & 0xff] == length)        \
+          {                                                                   \
+            continue;                                                         \
+          }                                                                   \
+                                                                              \
+        for (size_t i = 0, sum = 0; i < 256; i++)                             \
+          {                                                                   \
+            size_t const n = count[i];                                        \
+                                                                              \
+            count[i] = sum;                                                   \
+            sum += n;                                                         \
+          }                                                                   \
+                                                                              \
+        for (size_t i = 0; i < length; i++)                                   \
+          {                                                                   \
+            to[count[(name##key (from[i]) >> 8 * byte) & 0xff]++] = from[i];  \
+          }                                                                   \
+                                                                              \
+        SORT_SWAP (type *, from, to);                                         \
+      }                                                                       \
+                                                                              \
+    if (from != array)                                                        \
+      {                                                                       \
+        memcpy (array, from, length * sizeof (type));                         \
+      }                                                                       \
+  }                                                                           \
+                                                                              \
+  void                                                                        \
+  name##sort (type *array, size_t length)                                     \
+  {                                                                           \
+    if (array == NULL || length < 2)                                          \
+      {                                                                       \
+        return;                                                               \
+      }                                                                       \
+                                                                              \
+    type *buffer = length >= SORT_RADIX                                       \
+                   ? (type *) malloc (length * sizeof (type)) : NULL;         \
+                                                                              \
+    if (buffer != NULL)                                                       \
+      {                                                                       \
+        name##radix (array, buffer, length);                                  \
+        free (buffer);                                                        \
+                                                                              \
+        return;                                                               \
+      }                                                                       \
+                                                                              \
+    name##pdq (array, length, sortlog (length), 1);                           \
+  }                                                                           \
+                                                                              \
+  size_t                                                                      \
+  name##search (type const *array, size_t length, type key)                   \
+  {                                                                           \
+    if (array == NULL || length == 0)                                         \
+      {                                                                       \
+        return (0);                                                           \
+      }                                                                       \
+                                                                              \
+    type const *base = array;                                                 \
+                                                                              \
+    while (length > 1)                                                        \
+      {                                                                       \
+        size_t const half = length / 2;                                       \
+                                                                              \
+        base    = name##key (base[half]) < name##key (key) ? base + half      \
+                                                               : base;        \
+        length -= half;                                                       \
+      }                                                                       \
+                                                                              \
+    return ((size_t) (base - array) + (name##key (*base) < name##key (key))); \
+  }
+
+SORT_DEFINE (natural8,  natural8_t)
+SORT_DEFINE (natural16, natural16_t)
+SORT_DEFINE (natural32, natural32_t)
+SORT_DEFINE (natural64, natural64_t)
+
+SORT_DEFINE (integer8,  integer8_t)
+SORT_DEFINE (integer16, integer16_t)
+SORT_DEFINE (integer32, integer32_t)
+SORT_DEFINE (integer64, integer64_t)
+
+SORT_DEFINE (real32, real32_t)
+SORT_DEFINE (real64, real64_t)
+
+/*****************************************************************************
+*                                  Strings                                   *
+*****************************************************************************/
+
+/**
+ * The character of a string at a depth, i.e. beyond a prefix.
+ *
+ * @param string The string, of at least said depth.
+ * @param depth  Said depth.
+ * @return       Said character, as unsigned.
+ */
+static inline int
+stringat (char const *string, size_t depth)
+{
+  return ((unsigned char) string[depth]);
+}
+
+/**
+ * Sort strings sharing a prefix by insertion.
+ *
+ * @param array  The strings.
+ * @param length The number thereof.
+ * @param depth  The length of said prefix, thus not compared.
+ */
+static void
+stringinsertion (string_t *array, size_t length, size_t depth)
+{
+  for (size_t i = 1; i < length; i++)
+    {
+      string_t const x = array[i];
+
+      size_t j = i;
+
+      for ( ; j > 0 && strcmp (x + depth, array[j - 1] + depth) < 0; j--)
+        {
+          array[j] = array[j - 1];
+        }
+
+      array[j] = x;
+    }
+}
+
+/**
+ * Sort strings sharing a prefix by a multikey quicksort: partition them into
+ * those less than, equal to, and greater than a pivot, by their character
+ * beyond said prefix; those equal thereto share a prefix one longer.
+ *
+ * @param array  The strings.
+ * @param length The number thereof.
+ * @param depth  The length of said prefix.
+ */
+static void
+stringmultikey (string_t *array, size_t length, size_t depth)
+{
+  while (length > SORT_INSERTION)
+    {
+      size_t const half = length / 2;
+
+      int const a = stringat (array[0], depth);
+      int const b = stringat (array[half], depth);
+      int const c = stringat (array[length - 1], depth);
+
+      int const pivot = a < b ? (b < c ? b : a < c ? c : a)
+                              : (a < c ? a : b < c ? c : b);
+
+      /* [0, less) < pivot, [less, i) == pivot, (more, length) > pivot */
+
+      size_t less = 0;
+      size_t more = length;
+
+      for (size_t i = 0; i < more; )
+        {
+          int const x = stringat (array[i], depth);
+
+          if (x < pivot)
+            {
+              SORT_SWAP (string_t, array[less], array[i]);
+              less++;
+              i++;
+            }
+          else if (x > pivot)
+            {
+              more--;
+              SORT_SWAP (string_t, array[i], array[more]);
+            }
+          else
+            {
+              i++;
+            }
+        }
+
+      /* the equal part is sorted a character deeper, unless each ended */
+
+      struct part parts[3] =
+        {
+          { array,        less,          depth     },
+          { array + less, more - less,   depth + 1 },
+          { array + more, length - more, depth     },
+        };
+
+      if (pivot == 0)
+        {
+          parts[1].length = 0;
+        }
+
+      size_t largest = 0;
+
+      for (size_t i = 1; i < 3; i++)
+        {
+          largest = parts[i].length > parts[largest].length ? i : largest;
+        }
+
+      for (size_t i = 0; i < 3; i++)
+        {
+          if (i != largest)
+            {
+              stringmultikey (parts[i].array, parts[i].length, parts[i].depth);
+            }
+        }
+
+      array  = parts[largest].array;
+      length = parts[largest].length;
+      depth  = parts[largest].depth;
+    }
+
+  stringinsertion (array, length, depth);
+}
+
+/**
+ * Sort strings in ascending order, as by strcmp().
+ *
+ * @param array  The strings, each non-null.
+ * @param length The number thereof.
+ * @see          stringsearch().
+ */
+void
+stringsort (string_t *array, size_t length)
+{
+  if (array == NULL)
+    {
+      return;
+    }
+
+  stringmultikey (array, length, 0);
+}
+
+/**
+ * Search sorted strings for the first not less than a key.
+ *
+ * @param array  The strings, sorted by stringsort().
+ * @param length The number thereof.
+ * @param key    The key.
+ * @return       The index of said string, thus the length if none.
+ * @see          stringsort().
+ */
+size_t
+stringsearch (string_t const *array, size_t length, char const *key)
+{
+  if (array == NULL || key == NULL || length == 0)
+    {
+      return (0);
+    }
+
+  string_t const *base = array;
+
+  while (length > 1)
+    {
+      size_t const half = length / 2;
+
+      base    = strcmp (base[half], key) < 0 ? base + half : base;
+      length -= half;
+    }
+
+  return ((size_t) (base - array) + (strcmp (*base, key) < 0));
+}
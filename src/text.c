@@ -0,0 +1,311 @@
+/*****************************************************************************
+*                   Copyright (c) 2020-2021 Jack C. Lloyd.                   *
+*                            All rights reserved.                            *
+*****************************************************************************/
+
+#include "../include/context.h"
+#include "../include/text.h"
+#include "../include/vector.h"
+
+/*****************************************************************************
+*                              Standard Library                              *
+*****************************************************************************/
+
+#include <string.h>
+
+/*****************************************************************************
+*                                 Data Types                                 *
+*****************************************************************************/
+
+/** The least bit of each byte of a natural64. */
+#define TEXT_ONES  ((natural64_t) 0x0101010101010101)
+
+/** The most bit of each byte of a natural64. */
+#define TEXT_HIGHS ((natural64_t) 0x8080808080808080)
+
+/**
+ * Load a block of text, of TEXT_BLOCK characters.
+ *
+ * @param text The text, unaligned.
+ * @return     Said block.
+ */
+static inline natural64x2_t
+txtload (char const *text)
+{
+  natural64x2_t x;
+
+  memcpy (&x, text, sizeof (x));
+
+  return (x);
+}
+
+/**
+ * Whether a block holds a zero byte; a byte above a zero may be reported as
+ * zero, hence each candidate is compared thereafter.
+ *
+ * @param x The block.
+ * @return  Non-zero if so, otherwise zero.
+ */
+static inline int
+txtzero (natural64x2_t x)
+{
+  natural64x2_t const ones  = natural64x2splat (TEXT_ONES);
+  natural64x2_t const highs = natural64x2splat (TEXT_HIGHS);
+  natural64x2_t const inner = natural64x2xor (x, natural64x2splat (UINT64_MAX));
+
+  natural64x2_t const z = natural64x2and (natural64x2sub (x, ones),
+                                          natural64x2and (inner, highs));
+
+  natural64_t any = 0;
+
+  for (int i = 0; i < 2; i++)
+    {
+      any |= VECTOR_LANE (z, i);
+    }
+
+  return (any != 0);
+}
+
+/**
+ * Whether a pattern, of at least two characters, occurs at a position.
+ *
+ * @param text    The position.
+ * @param pattern The pattern.
+ * @return        Non-zero if so, otherwise zero.
+ */
+static inline int
+txtmatch (char const *text, struct slice pattern)
+{
+  size_t const last = pattern.length - 1;
+
+  return (text[0] == pattern.text[0] && text[last] == pattern.text[last]
+          && memcmp (text + 1, pattern.text + 1, last - 1) == 0);
+}
+
+/**
+ * Write part of a text to a buffer, as much as fits, leaving room for a
+ * null-terminator.
+ *
+ * @param buffer The buffer.
+ * @param size   The size of said buffer, in bytes.
+ * @param length The length written thus far.
+ * @param part   The part.
+ * @return       The length written thereafter.
+ */
+static size_t
+txtput (char *buffer, size_t size, size_t length, struct slice part)
+{
+  if (length + 1 < size)
+    {
+      size_t const room = size - length - 1;
+
+      memcpy (buffer + length, part.text,
+              part.length < room ? part.length : room);
+    }
+
+  return (length + part.length);
+}
+
+/*****************************************************************************
+*                                   Slices                                   *
+*****************************************************************************/
+
+/**
+ * Slice a null-terminated string, as a whole.
+ *
+ * @param string The string.
+ * @return       Said slice, empty if a null-pointer.
+ */
+struct slice
+txtslice (char const *string)
+{
+  struct slice z = { "", 0 };
+
+  if (string != NULL)
+    {
+      z.text   = string;
+      z.length = strlen (string);
+    }
+
+  return (z);
+}
+
+/**
+ * Find the first occurrence of a character.
+ *
+ * @param text      The text to search.
+ * @param character The character.
+ * @return          The index thereof, thus the length of the text if none.
+ */
+size_t
+txtfind (struct slice text, character_t character)
+{
+  if (text.text == NULL)
+    {
+      return (text.length);
+    }
+
+  char const *found = (char const *) memchr (text.text, character,
+                                             text.length);
+
+  return (found != NULL ? (size_t) (found - text.text) : text.length);
+}
+
+/**
+ * Search for the first occurrence of a pattern.
+ *
+ * @param text    The text to search.
+ * @param pattern The pattern, found at zero if empty.
+ * @return        The index thereof, thus the length of the text if none.
+ */
+size_t
+txtsearch (struct slice text, struct slice pattern)
+{
+  if (pattern.length == 0)
+    {
+      return (0);
+    }
+
+  if (text.text == NULL || pattern.text == NULL
+      || pattern.length > text.length)
+    {
+      return (text.length);
+    }
+
+  if (pattern.length == 1)
+    {
+      return (txtfind (text, pattern.text[0]));
+    }
+
+  /* a position is a candidate if, xor its first and last characters, zero */
+
+  size_t const last = pattern.length - 1;
+  size_t const end  = text.length - last;
+
+  natural64x2_t const first
+    = natural64x2splat (TEXT_ONES * (unsigned char) pattern.text[0]);
+  natural64x2_t const final
+    = natural64x2splat (TEXT_ONES * (unsigned char) pattern.text[last]);
+
+  size_t i = 0;
+
+  for ( ; i + TEXT_BLOCK <= end; i += TEXT_BLOCK)
+    {
+      natural64x2_t const x = natural64x2xor (txtload (text.text + i),
+                                              first);
+      natural64x2_t const y = natural64x2xor (txtload (text.text + i + last),
+                                              final);
+
+      if (!txtzero (natural64x2or (x, y)))
+        {
+          continue;
+        }
+
+      for (size_t j = i; j < i + TEXT_BLOCK; j++)
+        {
+          if (txtmatch (text.text + j, pattern))
+            {
+              return (j);
+            }
+        }
+    }
+
+  for ( ; i < end; i++)
+    {
+      if (txtmatch (text.text + i, pattern))
+        {
+          return (i);
+        }
+    }
+
+  return (text.length);
+}
+
+/**
+ * Split a text by a separator, as into the parts between each occurrence.
+ *
+ * @param text      The text to split.
+ * @param separator The separator, of which a text is but one part if empty.
+ * @param parts     The array to fill in, of slices of said text.
+ * @param length    The length of said array.
+ * @return          The number of parts, of which but the first length are
+ *                  filled in, thus at least one.
+ */
+size_t
+txtsplit (struct slice text, struct slice separator, struct slice *parts,
+          size_t length)
+{
+  size_t count = 0;
+
+  for (;;)
+    {
+      size_t const index = separator.length > 0
+                           ? txtsearch (text, separator) : text.length;
+
+      if (parts != NULL && count < length)
+        {
+          parts[count].text   = text.text;
+          parts[count].length = index;
+        }
+
+      count++;
+
+      if (index >= text.length)
+        {
+          break;
+        }
+
+      text.text   += index + separator.length;
+      text.length -= index + separator.length;
+    }
+
+  return (count);
+}
+
+/**
+ * Replace each occurrence of a pattern, as does snprintf(), thus writing a
+ * copy null-terminated.
+ *
+ * @param buffer      The buffer to write to.
+ * @param size        The size of said buffer, in bytes.
+ * @param text        The text.
+ * @param pattern     The pattern, of which a text is copied as is if empty.
+ * @param replacement The replacement.
+ * @return            The length written, or which would have been if said
+ *                    buffer were large enough, without the null-terminator.
+ */
+size_t
+txtreplace (char *buffer, size_t size, struct slice text,
+            struct slice pattern, struct slice replacement)
+{
+  size_t written = 0;
+
+  size = buffer != NULL ? size : 0;
+
+  for (;;)
+    {
+      size_t const index = pattern.length > 0
+                           ? txtsearch (text, pattern) : text.length;
+
+      struct slice const part = { text.text, index };
+
+      written = txtput (buffer, size, written, part);
+
+      if (index >= text.length)
+        {
+          break;
+        }
+
+      written = txtput (buffer, size, written, replacement);
+
+      text.text   += index + pattern.length;
+      text.length -= index + pattern.length;
+    }
+
+  if (size > 0)
+    {
+      buffer[written < size ? written : size - 1] = '\0';
+    }
+
+  return (written);
+}
@@ -0,0 +1,366 @@
+/*****************************************************************************
+*                   Copyright (c) 2020-2021 Jack C. Lloyd.                   *
+*                            All rights reserved.                            *
+*****************************************************************************/
+
+#include "../include/context.h"
+#include "../include/type.h"
+
+/*****************************************************************************
+*                              Standard Library                              *
+*****************************************************************************/
+
+#include <stdlib.h>
+
+/*****************************************************************************
+*                                 Data Types                                 *
+*****************************************************************************/
+
+#define WIDTH(type) (((type) & WIDTH_MASK) >> WIDTH_SHIFT)
+#define LANES(type) (1 << (((type) & LANES_MASK) >> LANES_SHIFT))
+
+/**
+ * The numeric types, in order of widening; the result of an operation is the
+ * first hereof to which both operands widen.
+ */
+static int const table[] =
+{
+  KIND_NATURAL8,  KIND_INTEGER8,
+  KIND_NATURAL16, KIND_INTEGER16,
+  KIND_NATURAL32, KIND_INTEGER32,
+  KIND_NATURAL64, KIND_INTEGER64,
+  KIND_REAL32,    KIND_REAL64,
+  KIND_NONE
+};
+
+/**
+ * The bits of precision of a numeric type: those of its magnitude for a
+ * natural or an integer, and those of its mantissa for a real.
+ *
+ * @param type The type.
+ * @return     Said bits.
+ */
+static int
+typprecision (int type)
+{
+  switch (type & CLASS_MASK)
+    {
+    case CLASS_NATURAL:
+      return (WIDTH (type) * CHAR_BIT);
+
+    case CLASS_INTEGER:
+      return (WIDTH (type) * CHAR_BIT - 1);
+
+    case CLASS_REAL:
+      return (WIDTH (type) == sizeof (float) ? FLT_MANT_DIG : DBL_MANT_DIG);
+
+    default:
+      return (0);
+    }
+}
+
+/*****************************************************************************
+*                                   Types                                    *
+*****************************************************************************/
+
+/**
+ * The size of a type; for a compound type, that of its element, such that an
+ * array of naturals of eight bits takes a byte per element; a procedure is
+ * passed as its slot.
+ *
+ * @param type The type.
+ * @return     The size of said type in bytes, zero if unknown, as is that of
+ *             a type parameter until it is instantiated.
+ */
+size_t
+typsize (int type)
+{
+  if (type & CLASS_PROCEDURE)
+    {
+      return (sizeof (size_t));
+    }
+
+  if ((type & CLASS_MASK) == CLASS_STRING)
+    {
+      return (sizeof (string_t));
+    }
+
+  if ((type & CLASS_MASK) == CLASS_GENERIC)
+    {
+      return (0);
+    }
+
+  return ((size_t) WIDTH (type) * LANES (type));
+}
+
+/**
+ * The vector of a type, e.g. "real32 <4>", of 16, 32, or 64 bytes, thus of
+ * the width of an SSE, an AVX2, or an AVX-512 register.
+ *
+ * @param type  The type of each lane, a natural, an integer, or a real.
+ * @param lanes The number of lanes, within [1, 64].
+ * @param z     A pointer to the type of said vector.
+ * @return      Zero on success, otherwise EXIT_UNDEFINED.
+ * @see         vector.h.
+ */
+int
+typvector (int type, long long lanes, int *z)
+{
+  if (z == NULL)
+    {
+      return (EXIT_NULLPTR);
+    }
+
+  int const base = type & CLASS_MASK;
+
+  if ((type & (CLASS_COMPOUND | CLASS_ATOMIC | CLASS_PROCEDURE
+               | LANES_MASK)) != 0
+      || (base != CLASS_NATURAL && base != CLASS_INTEGER && base != CLASS_REAL))
+    {
+      return (EXIT_UNDEFINED);
+    }
+
+  if (lanes < 1 || lanes > 64) /* those of a byte each, at most */
+    {
+      return (EXIT_UNDEFINED);
+    }
+
+  long long const length = WIDTH (type) * lanes;
+
+  if (length != 16 && length != 32 && length != 64)
+    {
+      return (EXIT_UNDEFINED);
+    }
+
+  int shift = 0;
+
+  while ((1LL << shift) < lanes)
+    {
+      shift++;
+    }
+
+  *z = type | shift << LANES_SHIFT;
+
+  return (EXIT_SUCCESS);
+}
+
+/**
+ * The atomic of a type, e.g. "atomic natural64", read and written as a whole
+ * by each thread; an atomic boolean, natural, integer, or real.
+ *
+ * @param type The type.
+ * @param z    A pointer to the type of said atomic.
+ * @return     Zero on success, otherwise EXIT_UNDEFINED.
+ * @see        atomic.h.
+ */
+int
+typatomic (int type, int *z)
+{
+  if (z == NULL)
+    {
+      return (EXIT_NULLPTR);
+    }
+
+  int const base = type & CLASS_MASK;
+
+  if ((type & (CLASS_COMPOUND | CLASS_ATOMIC | CLASS_PROCEDURE
+               | LANES_MASK)) != 0
+      || (base != CLASS_BOOLEAN && base != CLASS_NATURAL
+          && base != CLASS_INTEGER && base != CLASS_REAL))
+    {
+      return (EXIT_UNDEFINED);
+    }
+
+  *z = type | CLASS_ATOMIC;
+
+  return (EXIT_SUCCESS);
+}
+
+/**
+ * Whether a type converts implicitly, i.e. widens, to another: a natural or
+ * an integer to one of no lesser width, a natural to a wider integer, and a
+ * natural or an integer to a real whose mantissa holds its every value; a
+ * scalar converts to a vector of as many lanes as need be, by broadcasting.
+ * An atomic converts as its value, which is read (or written) as a whole.
+ *
+ * @param from The type to convert from.
+ * @param to   The type to convert to.
+ * @return     Zero if so, otherwise EXIT_UNDEFINED.
+ * @see        typwiden().
+ */
+int
+typconvert (int from, int to)
+{
+  from &= ~CLASS_ATOMIC;
+  to   &= ~CLASS_ATOMIC;
+
+  if (from == to)
+    {
+      return (EXIT_SUCCESS);
+    }
+
+  if ((from | to) & (CLASS_COMPOUND | CLASS_PROCEDURE))
+    {
+      return (EXIT_UNDEFINED);
+    }
+
+  if (from & LANES_MASK) /* a vector converts lane by lane */
+    {
+      if ((from & LANES_MASK) != (to & LANES_MASK))
+        {
+          return (EXIT_UNDEFINED);
+        }
+
+      from &= ~LANES_MASK;
+      to   &= ~LANES_MASK;
+    }
+  else if (to & LANES_MASK) /* a scalar is broadcast */
+    {
+      to &= ~LANES_MASK;
+    }
+
+  int const x = from & CLASS_MASK;
+  int const y = to & CLASS_MASK;
+
+  if ((x == CLASS_NATURAL || x == CLASS_INTEGER || x == CLASS_REAL) && x == y)
+    {
+      return (WIDTH (from) <= WIDTH (to) ? EXIT_SUCCESS : EXIT_UNDEFINED);
+    }
+
+  if ((x == CLASS_NATURAL && y == CLASS_INTEGER)
+      || ((x == CLASS_NATURAL || x == CLASS_INTEGER) && y == CLASS_REAL))
+    {
+      return (typprecision (from) <= typprecision (to) ? EXIT_SUCCESS
+                                                       : EXIT_UNDEFINED);
+    }
+
+  return (EXIT_UNDEFINED);
+}
+
+/**
+ * The narrowest type to which two types both widen, thus that of an
+ * arithmetic operation thereon; an unknown type widens to an unknown type.
+ *
+ * @param x The type of the first operand.
+ * @param y The type of the second operand.
+ * @param z A pointer to the type of the result.
+ * @return  Zero on success, otherwise EXIT_UNDEFINED, as for a natural of
+ *          64 bits and an integer, which have no common type, or vectors of
+ *          differing lanes.
+ * @see     typconvert().
+ */
+int
+typwiden (int x, int y, int *z)
+{
+  if (z == NULL)
+    {
+      return (EXIT_NULLPTR);
+    }
+
+  if (x == KIND_NONE || y == KIND_NONE)
+    {
+      *z = KIND_NONE;
+
+      return (EXIT_SUCCESS);
+    }
+
+  x &= ~CLASS_ATOMIC;
+  y &= ~CLASS_ATOMIC;
+
+  int const lanes = (x | y) & LANES_MASK;
+
+  if ((x & LANES_MASK) != 0 && (y & LANES_MASK) != 0
+      && (x & LANES_MASK) != (y & LANES_MASK))
+    {
+      *z = KIND_NONE;
+
+      return (EXIT_UNDEFINED);
+    }
+
+  /* widen lane by lane, thus as scalars */
+
+  x &= ~LANES_MASK;
+  y &= ~LANES_MASK;
+
+  if (typconvert (x, y) == EXIT_SUCCESS)
+    {
+      *z = y;
+    }
+  else if (typconvert (y, x) == EXIT_SUCCESS)
+    {
+      *z = x;
+    }
+  else
+    {
+      int const *it = table;
+
+      while (*it != KIND_NONE && (typconvert (x, *it) != EXIT_SUCCESS
+                                  || typconvert (y, *it) != EXIT_SUCCESS))
+        {
+          it++;
+        }
+
+      *z = *it;
+    }
+
+  if (*z == KIND_NONE)
+    {
+      return (EXIT_UNDEFINED);
+    }
+
+  if (lanes != 0 && typvector (*z, LANES (lanes), z) != EXIT_SUCCESS)
+    {
+      *z = KIND_NONE; /* the widened vector no longer fits in a register */
+
+      return (EXIT_UNDEFINED);
+    }
+
+  return (EXIT_SUCCESS);
+}
+
+/**
+ * The narrowest natural or integer type holding every value within bounds;
+ * a literal takes said type, thus widens to that of any other operand.
+ *
+ * @param base    CLASS_NATURAL or CLASS_INTEGER.
+ * @param minimum The least value.
+ * @param maximum The greatest value.
+ * @return        Said type, otherwise KIND_NONE.
+ */
+int
+typfit (int base, long long minimum, long long maximum)
+{
+  if (base == CLASS_NATURAL && minimum >= 0)
+    {
+      if (maximum <= UINT8_MAX)
+        {
+          return (KIND_NATURAL8);
+        }
+
+      if (maximum <= UINT16_MAX)
+        {
+          return (KIND_NATURAL16);
+        }
+
+      return (maximum <= (long long) UINT32_MAX ? KIND_NATURAL32
+                                                : KIND_NATURAL64);
+    }
+
+  if (base == CLASS_NATURAL || base == CLASS_INTEGER)
+    {
+      if (minimum >= INT8_MIN && maximum <= INT8_MAX)
+        {
+          return (KIND_INTEGER8);
+        }
+
+      if (minimum >= INT16_MIN && maximum <= INT16_MAX)
+        {
+          return (KIND_INTEGER16);
+        }
+
+      return (minimum >= INT32_MIN && maximum <= INT32_MAX ? KIND_INTEGER32
+                                                           : KIND_INTEGER64);
+    }
+
+  return (KIND_NONE);
+}